@@ -19,8 +19,32 @@ LinReg::LinReg(const double &bias, const double &weight,
     : myBias(bias)
     , myWeight(weight)
     , myLearningRate(learningRate)
-    , myTrainingInput(trainingInput)
-    , myTrainingOutput(trainingOutput)
+    , myTrainingData(trainingInput, trainingOutput)
+    , myCursor(0)
+    , mySteps(0)
+    , myLineSearch(false)
+{
+}
+
+/********************************************************************************
+ * @brief The constructor of the linear regression model training on a dataset
+ *        view
+ * 
+ * @param bias Initial bias value
+ * @param weight Initial weight value
+ * @param trainingData View of the training data
+ * @param learningRate Learning rate for the model
+ ********************************************************************************/
+LinReg::LinReg(const double &bias, const double &weight,
+    const Dataset &trainingData,
+    const double &learningRate)
+    : myBias(bias)
+    , myWeight(weight)
+    , myLearningRate(learningRate)
+    , myTrainingData(trainingData)
+    , myCursor(0)
+    , mySteps(0)
+    , myLineSearch(false)
 {
 }
 
@@ -44,6 +68,28 @@ double LinReg::getWeight() const
     return myWeight;
 }
 
+/********************************************************************************
+ * @brief Set the bias and weight values, e.g. when restoring a stored model
+ * 
+ * @param bias New bias value
+ * @param weight New weight value
+ ********************************************************************************/
+void LinReg::setCoefficients(const double &bias, const double &weight)
+{
+    myBias = bias;
+    myWeight = weight;
+}
+
+/********************************************************************************
+ * @brief Get the training data of the model
+ * 
+ * @return View of the training data
+ ********************************************************************************/
+const Dataset &LinReg::getTrainingData() const
+{
+    return myTrainingData;
+}
+
 /********************************************************************************
  * @brief Get the count of training sets
  * 
@@ -51,7 +97,7 @@ double LinReg::getWeight() const
  ********************************************************************************/
 int LinReg::getTrainingSetCount() const
 {
-    return myTrainingInput.size();
+    return myTrainingData.count();
 }
 
 /********************************************************************************
@@ -73,31 +119,149 @@ double LinReg::predict(const double &input) const
  ********************************************************************************/
 bool LinReg::train(const int &epochs)
 {
-    double prediction{};
-    double error{};
-        
+    if (myLineSearch) { return trainLineSearch(epochs); }
     if (epochs == 0 || myLearningRate <= 0) { return false; }
         
+    myCursor = 0;
     for (int i = 0; i < epochs; i++)
     {
-        for (auto j = 0U; j < myTrainingInput.size(); j++)
+        for (uint32_t j = 0; j < myTrainingData.count(); j++)
         {
-            const auto &ref(myTrainingOutput[j]);
-            const auto &input(myTrainingInput[j]);
-            
-            if(input == 0){
-                myBias = ref;
-            }
-            else{
-                prediction = predict(input);
-                error = ref - prediction;
-
-                myBias += error * myLearningRate;
-                myWeight += error * myLearningRate * input;
-            }                
+            trainStep();
         }
     }
     return true;
 }
 
+/********************************************************************************
+ * @brief Enable or disable line search
+ * 
+ * @param enable True to enable line search, false to use the learning rate
+ ********************************************************************************/
+void LinReg::setLineSearch(const bool &enable)
+{
+    myLineSearch = enable;
+}
+
+/********************************************************************************
+ * @brief Train the model with full-batch conjugate gradient descent and an 
+ *        exact line search. The loss is quadratic, so the optimal step along
+ *        a direction d is g^T d / d^T H d, where d^T H d is the sum of 
+ *        (d_b + d_w x)^2 and the sums needed for it are collected in the same
+ *        pass as the gradient g. With two coefficients the minimum is reached
+ *        in two epochs, hence the direction is restarted every other epoch
+ *        to shed rounding errors
+ * 
+ * @param epochs Number of epochs to train the model
+ * @return True if training was successful, false otherwise
+ ********************************************************************************/
+bool LinReg::trainLineSearch(const int &epochs)
+{
+    double directionBias = 0;
+    double directionWeight = 0;
+    double previousSlope = 0;
+
+    if (epochs == 0 || myTrainingData.empty()) { return false; }
+
+    for (int i = 0; i < epochs; i++)
+    {
+        double gradientBias = 0;
+        double gradientWeight = 0;
+        double sumInput = 0;
+        double sumSquaresInput = 0;
+
+        for (uint32_t j = 0; j < myTrainingData.count(); j++)
+        {
+            const auto &input(myTrainingData.input()[j]);
+            const double error = myTrainingData.output()[j] - predict(input);
+            gradientBias += error;
+            gradientWeight += error * input;
+            sumInput += input;
+            sumSquaresInput += input * input;
+        }
+
+        const double slope = gradientBias * gradientBias + gradientWeight * gradientWeight;
+        if (slope == 0) { break; }
+
+        const double beta = i % 2 == 0 ? 0 : slope / previousSlope;
+        directionBias = gradientBias + beta * directionBias;
+        directionWeight = gradientWeight + beta * directionWeight;
+        previousSlope = slope;
+
+        const double curvature = myTrainingData.count() * directionBias * directionBias + 
+            2 * sumInput * directionBias * directionWeight + 
+            sumSquaresInput * directionWeight * directionWeight;
+        if (curvature <= 0) { break; }
+
+        const double step = (gradientBias * directionBias + gradientWeight * directionWeight) / 
+            curvature;
+        myBias += step * directionBias;
+        myWeight += step * directionWeight;
+        mySteps += myTrainingData.count();
+    }
+    return true;
+}
+
+/********************************************************************************
+ * @brief Train the model on the next training set, i.e. perform a single 
+ *        gradient descent update
+ * 
+ * @return True if the update was performed, false otherwise
+ ********************************************************************************/
+bool LinReg::trainStep()
+{
+    if (myTrainingData.empty() || myLearningRate <= 0) { return false; }
+
+    if (myCursor >= myTrainingData.count()) { myCursor = 0; }
+    const uint32_t index = myCursor++;
+    mySteps++;
+
+    const auto &ref(myTrainingData.output()[index]);
+    const auto &input(myTrainingData.input()[index]);
+    
+    if(input == 0){
+        myBias = ref;
+    }
+    else{
+        const double error = ref - predict(input);
+        myBias += error * myLearningRate;
+        myWeight += error * myLearningRate * input;
+    }
+    return true;
+}
+
+/********************************************************************************
+ * @brief Get the number of training steps performed
+ * 
+ * @return Number of training steps
+ ********************************************************************************/
+uint32_t LinReg::getSteps() const
+{
+    return mySteps;
+}
+
+/********************************************************************************
+ * @brief Get the training state of the model
+ * 
+ * @return Current training state
+ ********************************************************************************/
+LinReg::State LinReg::getState() const
+{
+    return State{myBias, myWeight, myLearningRate, mySteps, myCursor};
+}
+
+/********************************************************************************
+ * @brief Restore a training state
+ * 
+ * @param state Training state to restore
+ ********************************************************************************/
+void LinReg::setState(const State &state)
+{
+    myBias = state.bias;
+    myWeight = state.weight;
+    myLearningRate = state.learningRate;
+    mySteps = state.steps;
+    myCursor = state.cursor;
+}
+
 } // namespace ml
\ No newline at end of file
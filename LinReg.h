@@ -10,6 +10,7 @@
  ********************************************************************************/
 #pragma once
 
+#include "dataset.h"
 #include "vector.h"
 #include "serial.h"
 
@@ -23,6 +24,25 @@ class LinReg
 {
 public:
 
+    /********************************************************************************
+     * @brief Training state of the model, i.e. everything needed to resume 
+     *        training exactly where it was left
+     * 
+     * @param bias Current bias value
+     * @param weight Current weight value
+     * @param learningRate Current learning rate
+     * @param steps Number of training steps performed
+     * @param cursor Index of the next training set
+     ********************************************************************************/
+    struct State
+    {
+        double bias;
+        double weight;
+        double learningRate;
+        uint32_t steps;
+        uint32_t cursor;
+    };
+
     /********************************************************************************
      * @brief Constructor for Linear Regression model
      * 
@@ -31,11 +51,26 @@ public:
      * @param trainingInput Vector of training input values
      * @param trainingOutput Vector of training output values
      * @param learningRate Learning rate for the model (default is 0.01)
+     * 
+     * @note The training data is viewed, not copied, so the vectors must 
+     *       outlive the model.
      ********************************************************************************/
     LinReg(const double &bias, const double &weight,    
         const container::Vector<double> &trainingInput,     
         const container::Vector<double> &trainingOutput,
         const double &learningRate = 0.01);
+
+    /********************************************************************************
+     * @brief Constructor for Linear Regression model training on a dataset view
+     * 
+     * @param bias Initial bias value
+     * @param weight Initial weight value
+     * @param trainingData View of the training data
+     * @param learningRate Learning rate for the model (default is 0.01)
+     ********************************************************************************/
+    LinReg(const double &bias, const double &weight,
+        const Dataset &trainingData,
+        const double &learningRate = 0.01);
     
     /********************************************************************************
      * @brief Get the current bias value
@@ -51,6 +86,21 @@ public:
      ********************************************************************************/
     double getWeight() const;
 
+    /********************************************************************************
+     * @brief Set the bias and weight values, e.g. when restoring a stored model
+     * 
+     * @param bias New bias value
+     * @param weight New weight value
+     ********************************************************************************/
+    void setCoefficients(const double &bias, const double &weight);
+
+    /********************************************************************************
+     * @brief Get the training data of the model
+     * 
+     * @return View of the training data
+     ********************************************************************************/
+    const Dataset &getTrainingData() const;
+
     /********************************************************************************
      * @brief Get the count of training sets
      * 
@@ -67,19 +117,70 @@ public:
     double predict(const double &input) const;
     
     /********************************************************************************
-     * @brief Train the linear regression model using the training data
+     * @brief Train the linear regression model using the training data. Every
+     *        call starts at the first training set and visits the training 
+     *        sets in order, so the result is deterministic
      * 
      * @param epochs Number of epochs to train the model
      * @return True if training was successful, false otherwise
      ********************************************************************************/
     bool train(const int &epochs);
 
+    /********************************************************************************
+     * @brief Enable or disable line search. With line search enabled, train 
+     *        performs full-batch (conjugate) gradient descent where the step 
+     *        size of each epoch is chosen exactly, i.e. it minimizes the squared
+     *        error along the search direction, so the learning rate is not used
+     *        and training can't diverge
+     * 
+     * @param enable True to enable line search, false to use the learning rate
+     ********************************************************************************/
+    void setLineSearch(const bool &enable);
+
+    /********************************************************************************
+     * @brief Train the model on the next training set, i.e. perform a single 
+     *        gradient descent update. Training can hence be spread over time,
+     *        e.g. one step per timer interrupt, without blocking the program,
+     *        and resumed mid-epoch from a restored training state
+     * 
+     * @return True if the update was performed, false if there is no training 
+     *         data or the learning rate is invalid
+     ********************************************************************************/
+    bool trainStep();
+
+    /********************************************************************************
+     * @brief Get the number of training steps performed
+     * 
+     * @return Number of training steps
+     ********************************************************************************/
+    uint32_t getSteps() const;
+
+    /********************************************************************************
+     * @brief Get the training state of the model, e.g. for a checkpoint
+     * 
+     * @return Current training state
+     ********************************************************************************/
+    State getState() const;
+
+    /********************************************************************************
+     * @brief Restore a training state, e.g. from a checkpoint. Training 
+     *        continued via trainStep then proceeds exactly as if it had never
+     *        been interrupted
+     * 
+     * @param state Training state to restore
+     ********************************************************************************/
+    void setState(const State &state);
+
 private:
     double myBias;                            
     double myWeight;                           
     double myLearningRate;                     
-    const container::Vector<double> myTrainingInput;  
-    const container::Vector<double> myTrainingOutput; 
+    Dataset myTrainingData;
+    uint32_t myCursor;
+    uint32_t mySteps;
+    bool myLineSearch;
+
+    bool trainLineSearch(const int &epochs);
 
 };
 
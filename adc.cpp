@@ -12,7 +12,6 @@ namespace
 {
 
 constexpr uint16_t MinVal{0U};
-constexpr uint16_t MaxVal{1023U};
 constexpr uint8_t AdcPortOffset{14U};
 
 // -----------------------------------------------------------------------------
@@ -36,6 +36,11 @@ struct Port
     static constexpr uint8_t C5{19}; // PORTC5 = pin 10
 };
 
+/********************************************************************************
+ * @brief The largest digital value (10-bit) returned by the AD converter.
+ ********************************************************************************/
+constexpr uint16_t MaxVal{1023U};
+
 /********************************************************************************
  * @brief Initializes AD converter by doing a test conversion.
  ********************************************************************************/
@@ -137,7 +137,7 @@ public:
      *
      * @return Pointer to the start address of the array.
      ********************************************************************************/
-    T* data() const;
+    const T* data() const;
 
     /********************************************************************************
      * @brief Returns the size of the array in the number of elements it can hold.
@@ -213,6 +213,7 @@ protected:
     void copy(const T (&values)[NumValues], const size_t offset = 0);
     template <size_t NumValues>
     void copy(const Array<T, NumValues>& source, const size_t offset = 0);
+    void copy(const T* values, const size_t numValues, const size_t offset);
 
     T myData[Size]{}; 
 };
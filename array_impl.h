@@ -5,6 +5,10 @@
  ********************************************************************************/
 #pragma once
 
+#include <string.h>
+
+#include "type_traits.h"
+
 #include "utils.h"
 
 namespace container
@@ -85,7 +89,7 @@ T* Array<T, Size>::data() { return myData; }
 
 // -----------------------------------------------------------------------------
 template <typename T, size_t Size>
-T* Array<T, Size>::data() const { return myData; }
+const T* Array<T, Size>::data() const { return myData; }
 
 // -----------------------------------------------------------------------------
 template <typename T, size_t Size>
@@ -148,8 +152,17 @@ typename Array<T, Size>::ConstIterator Array<T, Size>::rend() const
 template <typename T, size_t Size>
 void Array<T, Size>::clear() 
 {
-    for (auto& i : *this) {
-        i = {};
+    // Zero bytes are zero values for arithmetic types and null pointers, other
+    // types may have default values of their own.
+    if constexpr (type_traits::is_arithmetic<T>::value || type_traits::is_pointer<T>::value)
+    {
+        memset(myData, 0, sizeof(myData));
+    }
+    else
+    {
+        for (auto& i : *this) {
+            i = {};
+        }
     }
 }
 
@@ -158,10 +171,7 @@ template <typename T, size_t Size>
 template <size_t NumValues>
 void Array<T, Size>::copy(const T (&values)[NumValues], const size_t offset) 
 {
-    for (size_t i{}; i + offset < Size && i < NumValues; ++i) 
-    {
-        myData[offset + i] = values[i];
-    }
+    copy(values, NumValues, offset);
 }
 
 // -----------------------------------------------------------------------------
@@ -169,9 +179,26 @@ template <typename T, size_t Size>
 template <size_t NumValues>
 void Array<T, Size>::copy(const Array<T, NumValues>& source, const size_t offset) 
 {
-    for (size_t i{}; i + offset < Size && i < source.Size(); ++i) 
+    copy(source.data(), NumValues, offset);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size>
+void Array<T, Size>::copy(const T* values, const size_t numValues, const size_t offset) 
+{
+    if (offset >= Size) { return; }
+    const auto count{numValues < Size - offset ? numValues : Size - offset};
+
+    if constexpr (type_traits::is_trivially_copyable<T>::value)
+    {
+        memmove(myData + offset, values, count * sizeof(T));
+    }
+    else
     {
-        myData[offset + i] = source[i];
+        for (size_t i{}; i < count; ++i) 
+        {
+            myData[offset + i] = values[i];
+        }
     }
 }
 
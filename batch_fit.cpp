@@ -0,0 +1,33 @@
+/********************************************************************************
+ * @brief Implementation details of batch calibration.
+ ********************************************************************************/
+#include "batch_fit.h"
+
+namespace ml
+{
+
+// -----------------------------------------------------------------------------
+uint32_t batchFit(const double* inputArena,
+                  const double* outputArena,
+                  const uint32_t* offsets,
+                  Coefficients* coefficients,
+                  const uint32_t firstDevice,
+                  const uint32_t lastDevice)
+{
+    if (!inputArena || !outputArena || !offsets || !coefficients) { return 0U; }
+    uint32_t fitted{};
+
+    for (uint32_t device{firstDevice}; device < lastDevice; ++device)
+    {
+        const uint32_t begin{offsets[device]};
+        const uint32_t count{offsets[device + 1U] - begin};
+        Statistics statistics{};
+        statistics.add(inputArena + begin, outputArena + begin, count);
+
+        auto& model{coefficients[device]};
+        if (statistics.solve(model.bias, model.weight)) { fitted++; }
+    }
+    return fitted;
+}
+
+} // namespace ml
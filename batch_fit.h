@@ -0,0 +1,43 @@
+/********************************************************************************
+ * @brief Batch calibration of many small linear regression models, one per
+ *        device, whose datasets are packed into one contiguous arena.
+ ********************************************************************************/
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "statistics.h"
+
+namespace ml
+{
+
+/********************************************************************************
+ * @brief Fits one linear regression model per device with the closed-form
+ *        least squares solution, walking the arena once.
+ *
+ *        The samples of device i are stored at indexes offsets[i] up to (but
+ *        not including) offsets[i + 1] of the input and output arenas, hence
+ *        the offsets table must hold lastDevice + 1 entries. Every device is
+ *        fitted with scratch on the stack and writes only to its own entry of
+ *        the coefficient table, so disjoint device ranges can be fitted
+ *        concurrently without any locking.
+ *
+ * @param inputArena   Pointer to the packed input values of all devices.
+ * @param outputArena  Pointer to the packed output values of all devices.
+ * @param offsets      Pointer to the offsets table.
+ * @param coefficients Pointer to the coefficient table, one entry per device.
+ * @param firstDevice  Index of the first device to fit.
+ * @param lastDevice   Index one past the last device to fit.
+ *
+ * @return The number of devices fitted. Devices whose input values don't vary
+ *         are given their mean output as bias and weight 0, and aren't counted.
+ ********************************************************************************/
+uint32_t batchFit(const double* inputArena,
+                  const double* outputArena,
+                  const uint32_t* offsets,
+                  Coefficients* coefficients,
+                  const uint32_t firstDevice,
+                  const uint32_t lastDevice);
+
+} // namespace ml
@@ -0,0 +1,90 @@
+/********************************************************************************
+ * @brief Implementation details of the bootstrap confidence intervals.
+ ********************************************************************************/
+#include "bootstrap.h"
+#include "random.h"
+
+namespace ml
+{
+namespace
+{
+
+// -----------------------------------------------------------------------------
+template <typename Key>
+void sort(Coefficients* estimates, const uint32_t count, Key key)
+{
+    // Shell sort with Ciura's gaps, sorting in place without recursion.
+    constexpr uint16_t gaps[]{701U, 301U, 132U, 57U, 23U, 10U, 4U, 1U};
+    for (const auto gap : gaps)
+    {
+        for (uint32_t i{gap}; i < count; ++i)
+        {
+            const Coefficients estimate{estimates[i]};
+            uint32_t j{i};
+            for (; j >= gap && key(estimates[j - gap]) > key(estimate); j -= gap)
+            {
+                estimates[j] = estimates[j - gap];
+            }
+            estimates[j] = estimate;
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <typename Key>
+Interval percentiles(Coefficients* estimates, const uint32_t count,
+                     const uint32_t lower, const uint32_t upper, Key key)
+{
+    sort(estimates, count, key);
+    return Interval{key(estimates[lower]), key(estimates[upper])};
+}
+
+} // namespace
+
+// -----------------------------------------------------------------------------
+uint32_t bootstrapFit(const Dataset& data,
+                      const uint32_t seed,
+                      Coefficients* estimates,
+                      const uint32_t firstResample,
+                      const uint32_t lastResample)
+{
+    if (estimates == nullptr || data.empty() || firstResample >= lastResample) { return 0U; }
+    uint32_t fitted{};
+    for (uint32_t i{firstResample}; i < lastResample; ++i)
+    {
+        Random random{seed + i};
+        Statistics statistics{};
+
+        for (uint32_t j{}; j < data.count(); ++j)
+        {
+            const uint32_t index{random.next(data.count())};
+            statistics.add(data.input()[index], data.output()[index]);
+        }
+        if (statistics.solve(estimates[i].bias, estimates[i].weight)) { fitted++; }
+    }
+    return fitted;
+}
+
+// -----------------------------------------------------------------------------
+bool bootstrapInterval(Coefficients* estimates,
+                       const uint32_t resamples,
+                       const double confidence,
+                       Interval& bias,
+                       Interval& weight)
+{
+    if (estimates == nullptr || resamples == 0U || confidence <= 0.0 || confidence >= 1.0)
+    {
+        return false;
+    }
+    const double tail{(1.0 - confidence) / 2.0 * (resamples - 1U)};
+    const uint32_t lower{static_cast<uint32_t>(tail + 0.5)};
+    const uint32_t upper{resamples - 1U - lower};
+
+    bias = percentiles(estimates, resamples, lower, upper,
+                       [](const Coefficients& estimate) { return estimate.bias; });
+    weight = percentiles(estimates, resamples, lower, upper,
+                         [](const Coefficients& estimate) { return estimate.weight; });
+    return true;
+}
+
+} // namespace ml
@@ -0,0 +1,74 @@
+/********************************************************************************
+ * @brief Bootstrap confidence intervals for the coefficients of linear
+ *        regression models.
+ ********************************************************************************/
+#pragma once
+
+#include <stdint.h>
+
+#include "dataset.h"
+#include "statistics.h"
+
+namespace ml
+{
+
+/********************************************************************************
+ * @brief Confidence interval of an estimated value.
+ *
+ * @param lower The lower bound of the interval.
+ * @param upper The upper bound of the interval.
+ ********************************************************************************/
+struct Interval
+{
+    double lower{};
+    double upper{};
+};
+
+/********************************************************************************
+ * @brief Fits the bootstrap resamples with indexes firstResample up to (but not
+ *        including) lastResample of referenced training data.
+ *
+ *        Each resample draws count indexes with replacement and feeds the
+ *        indexed samples straight into the sufficient statistics, so no data
+ *        is copied. Resample i is drawn from its own generator seeded with
+ *        seed + i, hence the estimates don't depend on how the resamples are
+ *        split, and disjoint ranges can be fitted concurrently without any
+ *        locking.
+ *
+ * @param data          Reference to the training data.
+ * @param seed          The seed of the resampling.
+ * @param estimates     Pointer to the estimate table, one entry per resample.
+ * @param firstResample Index of the first resample to fit.
+ * @param lastResample  Index one past the last resample to fit.
+ *
+ * @return The number of resamples fitted. Resamples whose input values don't
+ *         vary are given their mean output as bias and weight 0, and aren't
+ *         counted. Nothing is fitted if the estimate table is missing, the
+ *         training data is empty or the range of resamples is empty.
+ ********************************************************************************/
+uint32_t bootstrapFit(const Dataset& data,
+                      const uint32_t seed,
+                      Coefficients* estimates,
+                      const uint32_t firstResample,
+                      const uint32_t lastResample);
+
+/********************************************************************************
+ * @brief Computes percentile confidence intervals of the bias and the weight
+ *        from bootstrap estimates. The estimate table is reordered.
+ *
+ * @param estimates  Pointer to the estimate table.
+ * @param resamples  The number of estimates in the table.
+ * @param confidence The confidence level, e.g. 0.95 for a 95 % interval.
+ * @param bias       Reference to variable for storing the bias interval.
+ * @param weight     Reference to variable for storing the weight interval.
+ *
+ * @return True if the intervals were computed, false if the table is empty or
+ *         missing, or the confidence level isn't in the range (0, 1).
+ ********************************************************************************/
+bool bootstrapInterval(Coefficients* estimates,
+                       const uint32_t resamples,
+                       const double confidence,
+                       Interval& bias,
+                       Interval& weight);
+
+} // namespace ml
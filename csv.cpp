@@ -0,0 +1,157 @@
+/********************************************************************************
+ * @brief Implementation details of numeric CSV parsing.
+ ********************************************************************************/
+#include "csv.h"
+
+namespace ml
+{
+namespace csv
+{
+namespace
+{
+
+constexpr char Separator{','};
+constexpr char NewLine{'\n'};
+constexpr char CarriageReturn{'\r'};
+constexpr uint32_t MantissaLimit{429496729U};
+constexpr double BinaryPowers[]{1e1, 1e2, 1e4, 1e8, 1e16};
+constexpr double LargePower{1e32};
+constexpr uint16_t LargePowerExponent{32U};
+
+// -----------------------------------------------------------------------------
+constexpr bool isDigit(const char c) { return c >= '0' && c <= '9'; }
+
+// -----------------------------------------------------------------------------
+constexpr bool isBlank(const char c) { return c == ' ' || c == '\t'; }
+
+// -----------------------------------------------------------------------------
+double scale(const double value, const int16_t exponent)
+{
+    // The power of ten is built from the binary digits of the exponent. Up to
+    // 10^22 all factors and products are exact, so the value is rounded only
+    // once, by the final multiplication or division.
+    if (value == 0.0 || exponent == 0) { return value; }
+    auto remaining{static_cast<uint16_t>(exponent < 0 ? -exponent : exponent)};
+    double power{1.0};
+
+    for (; remaining >= LargePowerExponent; remaining -= LargePowerExponent) 
+    { 
+        power *= LargePower; 
+    }
+    for (uint8_t bit{}; remaining > 0U; ++bit, remaining >>= 1U)
+    {
+        if (remaining & 1U) { power *= BinaryPowers[bit]; }
+    }
+    return exponent > 0 ? value * power : value / power;
+}
+
+// -----------------------------------------------------------------------------
+const char* skipBlanks(const char* first, const char* last)
+{
+    while (first < last && isBlank(*first)) { ++first; }
+    return first;
+}
+
+} // namespace
+
+// -----------------------------------------------------------------------------
+const char* parseNumber(const char* first, const char* last, double& value)
+{
+    const char* i{first};
+    const bool negative{i < last && *i == '-'};
+    if (i < last && (*i == '-' || *i == '+')) { ++i; }
+
+    uint32_t mantissa{};
+    int16_t exponent{};
+    bool hasDigits{false};
+
+    for (; i < last && isDigit(*i); ++i, hasDigits = true)
+    {
+        // Dropped digits only scale the value, saturated like the exponent part.
+        if (mantissa < MantissaLimit) { mantissa = mantissa * 10U + (*i - '0'); }
+        else if (exponent < 1000) { exponent++; }
+    }
+    if (i < last && *i == '.')
+    {
+        for (++i; i < last && isDigit(*i); ++i, hasDigits = true)
+        {
+            if (mantissa < MantissaLimit)
+            {
+                mantissa = mantissa * 10U + (*i - '0');
+                exponent--;
+            }
+        }
+    }
+    if (!hasDigits) { return nullptr; }
+
+    if (i < last && (*i == 'e' || *i == 'E'))
+    {
+        const char* j{i + 1};
+        const bool negativeExponent{j < last && *j == '-'};
+        if (j < last && (*j == '-' || *j == '+')) { ++j; }
+
+        if (j < last && isDigit(*j))
+        {
+            int16_t power{};
+            for (; j < last && isDigit(*j); ++j)
+            {
+                if (power < 1000) { power = power * 10 + (*j - '0'); }
+            }
+            exponent += negativeExponent ? -power : power;
+            i = j;
+        }
+    }
+
+    const double magnitude{scale(static_cast<double>(mantissa), exponent)};
+    value = negative ? -magnitude : magnitude;
+    return i;
+}
+
+// -----------------------------------------------------------------------------
+const char* nextLine(const char* first, const char* last)
+{
+    while (first < last && *first != NewLine) { ++first; }
+    return first < last ? first + 1 : last;
+}
+
+// -----------------------------------------------------------------------------
+uint32_t parse(const char* first, const char* last,
+               double* const* columns, const uint8_t columnCount,
+               const uint32_t capacity)
+{
+    if (!first || !columns || columnCount == 0U) { return 0U; }
+    uint32_t rows{};
+
+    while (first < last && rows < capacity)
+    {
+        const char* end{nextLine(first, last)};
+        const char* i{first};
+        uint8_t column{};
+
+        for (; column < columnCount; ++column)
+        {
+            i = skipBlanks(i, end);
+            double value{};
+            i = parseNumber(i, end, value);
+            if (i == nullptr) { break; }
+            columns[column][rows] = value;
+            i = skipBlanks(i, end);
+
+            if (column + 1U < columnCount)
+            {
+                if (i >= end || *i != Separator) { break; }
+                ++i;
+            }
+            else if (i < end && *i != Separator && *i != NewLine && *i != CarriageReturn)
+            {
+                break;
+            }
+        }
+        if (column == columnCount) { rows++; }
+        first = end;
+    }
+    return rows;
+}
+
+} // namespace csv
+} // namespace ml
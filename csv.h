@@ -0,0 +1,68 @@
+/********************************************************************************
+ * @brief Allocation-free parsing of numeric CSV data into preallocated
+ *        column buffers, e.g. the columns of a training dataset.
+ ********************************************************************************/
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace ml
+{
+namespace csv
+{
+
+/********************************************************************************
+ * @brief Parses a decimal floating-point number, optionally signed and with
+ *        an exponent, at the start of specified text. No leading whitespace
+ *        is skipped.
+ *
+ * @note The first 9 significant digits are used, further digits are 
+ *       truncated. The value is then scaled by a single multiplication or
+ *       division with a power of ten, which is exact for powers up to 10^22
+ *       where double is 64 bits wide. Such numbers are correctly rounded,
+ *       while larger exponents may be off by a few units in the last place.
+ *       On AVR, where double is 32 bits wide, the results are within a few
+ *       units in the last place. Results below the normal range flush to 0.
+ *
+ * @param first Pointer to the first character of the text.
+ * @param last  Pointer one past the last character of the text.
+ * @param value Reference to variable for storing the parsed value.
+ *
+ * @return Pointer to the first character not part of the number, or a null
+ *         pointer if no number was found, in which case value is unchanged.
+ ********************************************************************************/
+const char* parseNumber(const char* first, const char* last, double& value);
+
+/********************************************************************************
+ * @brief Provides the start of the line following specified position. Text
+ *        split at the returned positions can be parsed in independent chunks.
+ *
+ * @param first Pointer to the position to search from.
+ * @param last  Pointer one past the last character of the text.
+ *
+ * @return Pointer to the first character of the next line, or last if there
+ *         is no next line.
+ ********************************************************************************/
+const char* nextLine(const char* first, const char* last);
+
+/********************************************************************************
+ * @brief Parses lines of comma-separated numbers into referenced columns.
+ *        Each line must hold at least columnCount numbers. Lines that don't,
+ *        such as a header line or blank lines, are skipped. Additional
+ *        fields are ignored.
+ *
+ * @param first       Pointer to the first character of the text.
+ * @param last        Pointer one past the last character of the text.
+ * @param columns     Pointer to the column buffers, one per parsed column.
+ * @param columnCount The number of columns to parse.
+ * @param capacity    The number of rows each column buffer can hold.
+ *
+ * @return The number of rows stored in the columns.
+ ********************************************************************************/
+uint32_t parse(const char* first, const char* last,
+               double* const* columns, const uint8_t columnCount,
+               const uint32_t capacity);
+
+} // namespace csv
+} // namespace ml
@@ -0,0 +1,130 @@
+/********************************************************************************
+ * @brief Implementation details of training data views and dataset images.
+ ********************************************************************************/
+#include "dataset.h"
+#include "statistics.h"
+
+namespace ml
+{
+namespace
+{
+
+// -----------------------------------------------------------------------------
+constexpr uint32_t align(const uint32_t offset)
+{
+    return (offset + Dataset::ColumnAlignment - 1U) & ~(Dataset::ColumnAlignment - 1U);
+}
+
+// -----------------------------------------------------------------------------
+constexpr uint32_t inputOffset() { return align(sizeof(Dataset::Header)); }
+
+// -----------------------------------------------------------------------------
+constexpr uint32_t outputOffset(const uint32_t count)
+{
+    return align(inputOffset() + count * sizeof(double));
+}
+
+// -----------------------------------------------------------------------------
+bool isAligned(const uint8_t* image)
+{
+    return reinterpret_cast<uintptr_t>(image) % alignof(Dataset::Header) == 0U;
+}
+
+} // namespace
+
+// -----------------------------------------------------------------------------
+Dataset::Dataset(const double* input, const double* output, const uint32_t count)
+    : myInput{input}
+    , myOutput{output}
+    , myCount{input && output ? count : 0U}
+{
+}
+
+// -----------------------------------------------------------------------------
+Dataset::Dataset(const container::Vector<double>& input,
+                 const container::Vector<double>& output)
+    : Dataset{input.data(), output.data(),
+              input.size() < output.size() ? input.size() : output.size()}
+{
+}
+
+// -----------------------------------------------------------------------------
+const double* Dataset::input() const { return myInput; }
+
+// -----------------------------------------------------------------------------
+const double* Dataset::output() const { return myOutput; }
+
+// -----------------------------------------------------------------------------
+uint32_t Dataset::count() const { return myCount; }
+
+// -----------------------------------------------------------------------------
+bool Dataset::empty() const { return myCount == 0U; }
+
+// -----------------------------------------------------------------------------
+uint32_t Dataset::imageSize(const uint32_t count)
+{
+    return outputOffset(count) + count * sizeof(double);
+}
+
+// -----------------------------------------------------------------------------
+bool Dataset::pack(uint8_t* image, const uint32_t size) const
+{
+    if (!image || !isAligned(image) || size < imageSize(myCount)) { return false; }
+    auto& header{*reinterpret_cast<Header*>(image)};
+    auto input{reinterpret_cast<double*>(image + inputOffset())};
+    auto output{reinterpret_cast<double*>(image + outputOffset(myCount))};
+    Statistics statistics{};
+
+    header = Header{};
+    header.minInput = myCount > 0U ? myInput[0U] : 0.0;
+    header.maxInput = header.minInput;
+
+    for (uint32_t i{}; i < myCount; ++i)
+    {
+        input[i] = myInput[i];
+        output[i] = myOutput[i];
+        statistics.add(myInput[i], myOutput[i]);
+        if (myInput[i] < header.minInput) { header.minInput = myInput[i]; }
+        if (myInput[i] > header.maxInput) { header.maxInput = myInput[i]; }
+    }
+
+    header.magic = Magic;
+    header.version = Version;
+    header.valueSize = sizeof(double);
+    header.count = myCount;
+    header.inputOffset = inputOffset();
+    header.outputOffset = outputOffset(myCount);
+    header.meanInput = statistics.meanInput();
+    header.meanOutput = statistics.meanOutput();
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+bool Dataset::open(const uint8_t* image, const uint32_t size, Dataset& dataset)
+{
+    if (!image || !isAligned(image) || size < sizeof(Header)) { return false; }
+    const auto& header{Dataset::header(image)};
+
+    if (header.magic != Magic || header.version != Version ||
+        header.valueSize != sizeof(double) ||
+        header.count > size / sizeof(double) ||
+        header.inputOffset != inputOffset() ||
+        header.outputOffset != outputOffset(header.count) ||
+        imageSize(header.count) > size)
+    {
+        return false;
+    }
+
+    dataset = Dataset{reinterpret_cast<const double*>(image + header.inputOffset),
+                      reinterpret_cast<const double*>(image + header.outputOffset),
+                      header.count};
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+const Dataset::Header& Dataset::header(const uint8_t* image)
+{
+    return *reinterpret_cast<const Dataset::Header*>(image);
+}
+
+} // namespace ml
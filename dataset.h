@@ -0,0 +1,163 @@
+/********************************************************************************
+ * @brief Zero-copy views of training data and a versioned columnar binary
+ *        format for storing training data as one contiguous image.
+ ********************************************************************************/
+#pragma once
+
+#include <stdint.h>
+
+#include "vector.h"
+
+namespace ml
+{
+
+/********************************************************************************
+ * @brief Class for non-owning views of training data stored as two columns,
+ *        one holding the input values and one holding the output values.
+ *        The referenced data must outlive the view.
+ *
+ *        A dataset image is laid out as a header followed by the input column
+ *        and the output column, each aligned to ColumnAlignment bytes:
+ *
+ *        | Header | padding | input column | padding | output column |
+ ********************************************************************************/
+class Dataset
+{
+public:
+
+    /********************************************************************************
+     * @brief Header of a dataset image.
+     *
+     * @param magic        Identifies the image as a dataset image.
+     * @param version      Format version of the image.
+     * @param valueSize    Size of each stored value in bytes, i.e. the size of
+     *                     double on the platform that packed the image.
+     * @param count        The number of samples in the image.
+     * @param inputOffset  Byte offset of the input column from the image start.
+     * @param outputOffset Byte offset of the output column from the image start.
+     * @param minInput     The smallest input value.
+     * @param maxInput     The largest input value.
+     * @param meanInput    The mean input value.
+     * @param meanOutput   The mean output value.
+     ********************************************************************************/
+    struct Header
+    {
+        uint16_t magic;
+        uint8_t version;
+        uint8_t valueSize;
+        uint32_t count;
+        uint32_t inputOffset;
+        uint32_t outputOffset;
+        double minInput;
+        double maxInput;
+        double meanInput;
+        double meanOutput;
+    };
+
+    static constexpr uint16_t Magic{0x444CU};
+    static constexpr uint8_t Version{1U};
+    static constexpr uint32_t ColumnAlignment{8U};
+
+    /********************************************************************************
+     * @brief Creates empty dataset.
+     ********************************************************************************/
+    Dataset() = default;
+
+    /********************************************************************************
+     * @brief Creates dataset viewing referenced columns.
+     *
+     * @param input  Pointer to the input values.
+     * @param output Pointer to the output values.
+     * @param count  The number of samples.
+     ********************************************************************************/
+    Dataset(const double* input, const double* output, const uint32_t count);
+
+    /********************************************************************************
+     * @brief Creates dataset viewing the content of referenced vectors. If the
+     *        vectors differ in size, only the overlapping samples are viewed.
+     *
+     * @param input  Reference to vector holding the input values.
+     * @param output Reference to vector holding the output values.
+     ********************************************************************************/
+    Dataset(const container::Vector<double>& input,
+            const container::Vector<double>& output);
+
+    /********************************************************************************
+     * @brief Provides the input column.
+     *
+     * @return Pointer to the input values.
+     ********************************************************************************/
+    const double* input() const;
+
+    /********************************************************************************
+     * @brief Provides the output column.
+     *
+     * @return Pointer to the output values.
+     ********************************************************************************/
+    const double* output() const;
+
+    /********************************************************************************
+     * @brief Provides the number of samples.
+     *
+     * @return The number of samples in the dataset.
+     ********************************************************************************/
+    uint32_t count() const;
+
+    /********************************************************************************
+     * @brief Indicates if the dataset is empty.
+     *
+     * @return True if the dataset holds no samples, else false.
+     ********************************************************************************/
+    bool empty() const;
+
+    /********************************************************************************
+     * @brief Provides the size of a dataset image holding specified number of
+     *        samples.
+     *
+     * @param count The number of samples.
+     *
+     * @return The size of the image in bytes.
+     ********************************************************************************/
+    static uint32_t imageSize(const uint32_t count);
+
+    /********************************************************************************
+     * @brief Packs the dataset into referenced image, which must be aligned for
+     *        the header and column types.
+     *
+     * @param image Pointer to the destination image.
+     * @param size  The size of the destination image in bytes.
+     *
+     * @return True if the dataset was packed, false if the image is too small
+     *         or misaligned.
+     ********************************************************************************/
+    bool pack(uint8_t* image, const uint32_t size) const;
+
+    /********************************************************************************
+     * @brief Opens referenced image as a dataset without copying any values.
+     *        The image is validated before the columns are viewed.
+     *
+     * @param image   Pointer to the image.
+     * @param size    The size of the image in bytes.
+     * @param dataset Reference to the dataset set to view the image.
+     *
+     * @return True if the image was opened, false if the image is invalid.
+     ********************************************************************************/
+    static bool open(const uint8_t* image, const uint32_t size, Dataset& dataset);
+
+    /********************************************************************************
+     * @brief Provides the header of referenced image. The header is only valid
+     *        if the image has been opened successfully.
+     *
+     * @param image Pointer to the image.
+     *
+     * @return Reference to the header of the image.
+     ********************************************************************************/
+    static const Header& header(const uint8_t* image);
+
+private:
+    const double* myInput{nullptr};
+    const double* myOutput{nullptr};
+    uint32_t myCount{};
+};
+
+} // namespace ml
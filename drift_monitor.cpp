@@ -0,0 +1,56 @@
+/********************************************************************************
+ * @brief Implementation details of the drift monitor.
+ ********************************************************************************/
+#include "drift_monitor.h"
+
+namespace ml
+{
+
+// -----------------------------------------------------------------------------
+DriftMonitor::DriftMonitor(const double tolerance, const double threshold,
+                           void (*callback)(void* context), void* context)
+    : myTolerance{tolerance}
+    , myThreshold{threshold}
+    , myCallback{callback}
+    , myContext{context}
+{
+}
+
+// -----------------------------------------------------------------------------
+bool DriftMonitor::update(const double residual)
+{
+    if (myCount < UINT16_MAX) { myCount++; }
+    myMean += (residual - myMean) / myCount;
+
+    myIncrease += residual - myMean - myTolerance;
+    myDecrease += residual - myMean + myTolerance;
+    if (myIncrease < myMinIncrease) { myMinIncrease = myIncrease; }
+    if (myDecrease > myMaxDecrease) { myMaxDecrease = myDecrease; }
+
+    if (myIncrease - myMinIncrease <= myThreshold &&
+        myMaxDecrease - myDecrease <= myThreshold)
+    {
+        return false;
+    }
+
+    myDetections++;
+    reset();
+    if (myCallback) { myCallback(myContext); }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+void DriftMonitor::reset()
+{
+    myMean = 0.0;
+    myIncrease = 0.0;
+    myMinIncrease = 0.0;
+    myDecrease = 0.0;
+    myMaxDecrease = 0.0;
+    myCount = 0U;
+}
+
+// -----------------------------------------------------------------------------
+uint16_t DriftMonitor::detections() const { return myDetections; }
+
+} // namespace ml
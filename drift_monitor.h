@@ -0,0 +1,79 @@
+/********************************************************************************
+ * @brief Concept-drift detection on the residuals of live predictions.
+ ********************************************************************************/
+#pragma once
+
+#include <stdint.h>
+
+namespace ml
+{
+
+/********************************************************************************
+ * @brief Class for detecting drift of a model via the two-sided Page-Hinkley
+ *        test. The monitor is fed the residuals between predictions and
+ *        occasional reference readings, and flags drift once the cumulative
+ *        deviation of the residuals from their running mean exceeds the
+ *        threshold in either direction. The state is constant in size.
+ *
+ *        The callback receives a context pointer, typically the model or the
+ *        recalibration state, so detected drift can trigger recalibration
+ *        directly, e.g. restart a RecursiveLeastSquares estimator from the
+ *        current coefficients or retrain a LinReg model.
+ ********************************************************************************/
+class DriftMonitor
+{
+public:
+
+    /********************************************************************************
+     * @brief Creates new drift monitor.
+     *
+     * @param tolerance The magnitude of change tolerated per sample (delta).
+     * @param threshold The cumulative deviation that flags drift (lambda).
+     * @param callback  Function pointer to the callback routine to call when
+     *                  drift is detected, e.g. to recalibrate the model
+     *                  (default = none).
+     * @param context   Pointer passed to the callback routine, e.g. the model
+     *                  to recalibrate (default = none).
+     ********************************************************************************/
+    DriftMonitor(const double tolerance, const double threshold,
+                 void (*callback)(void* context) = nullptr,
+                 void* context = nullptr);
+
+    /********************************************************************************
+     * @brief Adds a residual (reference value - predicted value) to the test.
+     *        When drift is detected, the test is restarted and the callback
+     *        routine is called with the context pointer.
+     *
+     * @param residual The new residual.
+     *
+     * @return True if drift was detected, else false.
+     ********************************************************************************/
+    bool update(const double residual);
+
+    /********************************************************************************
+     * @brief Restarts the test, e.g. after the model has been recalibrated.
+     ********************************************************************************/
+    void reset();
+
+    /********************************************************************************
+     * @brief Provides the number of times drift has been detected.
+     *
+     * @return The number of detections.
+     ********************************************************************************/
+    uint16_t detections() const;
+
+private:
+    double myMean{};
+    double myIncrease{};
+    double myMinIncrease{};
+    double myDecrease{};
+    double myMaxDecrease{};
+    double myTolerance;
+    double myThreshold;
+    void (*myCallback)(void* context);
+    void* myContext;
+    uint16_t myCount{};
+    uint16_t myDetections{};
+};
+
+} // namespace ml
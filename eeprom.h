@@ -49,6 +49,51 @@ bool write(const uint16_t address, const T& data);
 template <typename T = uint8_t>
 bool read(const uint16_t address, T& data);
 
+/********************************************************************************
+ * @brief Writes a block of bytes to consecutive addresses in EEPROM, starting
+ *        at specified address. Bytes already holding the new value are not
+ *        rewritten, which saves both time and EEPROM wear.
+ *
+ * @param address The start address.
+ * @param data    Pointer to the bytes to write.
+ * @param size    The number of bytes to write.
+ *
+ * @return True upon successful write, false if the block doesn't fit in EEPROM.
+ ********************************************************************************/
+bool writeBytes(const uint16_t address, const uint8_t* data, const uint16_t size);
+
+/********************************************************************************
+ * @brief Reads a block of bytes from consecutive addresses in EEPROM, starting
+ *        at specified address.
+ *
+ * @param address The start address.
+ * @param data    Pointer to the buffer for storing the bytes read.
+ * @param size    The number of bytes to read.
+ *
+ * @return True upon successful read, false if the block doesn't fit in EEPROM.
+ ********************************************************************************/
+bool readBytes(const uint16_t address, uint8_t* data, const uint16_t size);
+
+/********************************************************************************
+ * @brief Indicates if the EEPROM is ready, i.e. no write is in progress.
+ *
+ * @return True if the EEPROM is ready, else false.
+ ********************************************************************************/
+bool isReady();
+
+/********************************************************************************
+ * @brief Writes a byte to specified address in EEPROM without waiting for a
+ *        previous write to complete, so it can be called from time-critical
+ *        code. An unchanged byte isn't rewritten.
+ *
+ * @param address The destination address.
+ * @param data    The byte to write.
+ *
+ * @return True if the byte was written (or already stored), false if the
+ *         EEPROM is busy or an invalid address was specified.
+ ********************************************************************************/
+bool tryWrite(const uint16_t address, const uint8_t data);
+
 } // namespace
 } // namespace eeprom
 } // namespace driver
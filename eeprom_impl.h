@@ -23,6 +23,12 @@ bool constexpr isAddressValid(const uint16_t address)
     return address <= AddressWidth - sizeof(T);
 }
 
+// -----------------------------------------------------------------------------
+bool constexpr isBlockValid(const uint16_t address, const uint16_t size) 
+{
+    return size <= AddressWidth && address <= AddressWidth - size;
+}
+
 // -----------------------------------------------------------------------------
 void writeByte(const uint16_t address, const uint8_t data) 
 {
@@ -47,7 +53,7 @@ uint8_t readByte(const uint16_t address)
 } // namespace detail
 
 // -----------------------------------------------------------------------------
-template <typename T = uint8_t>
+template <typename T>
 bool write(const uint16_t address, const T& data) 
 {
     static_assert(type_traits::is_unsigned<T>::value, 
@@ -61,7 +67,7 @@ bool write(const uint16_t address, const T& data)
 }
 
 // -----------------------------------------------------------------------------
-template <typename T = uint8_t>
+template <typename T>
 bool read(const uint16_t address, T& data) 
 {
     static_assert(type_traits::is_unsigned<T>::value, 
@@ -74,6 +80,42 @@ bool read(const uint16_t address, T& data)
     return true;
 }
 
+// -----------------------------------------------------------------------------
+bool writeBytes(const uint16_t address, const uint8_t* data, const uint16_t size)
+{
+    if (data == nullptr || !detail::isBlockValid(address, size)) { return false; }
+    for (uint16_t i{}; i < size; ++i)
+    {
+        if (detail::readByte(address + i) != data[i])
+        {
+            detail::writeByte(address + i, data[i]);
+        }
+    }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+bool readBytes(const uint16_t address, uint8_t* data, const uint16_t size)
+{
+    if (data == nullptr || !detail::isBlockValid(address, size)) { return false; }
+    for (uint16_t i{}; i < size; ++i)
+    {
+        data[i] = detail::readByte(address + i);
+    }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+bool isReady() { return !utils::read(EECR, EEPE); }
+
+// -----------------------------------------------------------------------------
+bool tryWrite(const uint16_t address, const uint8_t data)
+{
+    if (!isReady() || !detail::isAddressValid(address)) { return false; }
+    if (detail::readByte(address) != data) { detail::writeByte(address, data); }
+    return true;
+}
+
 } // namespace
 } // namespace eeprom
 } // namespace driver
@@ -0,0 +1,101 @@
+/********************************************************************************
+ * @brief Implementation details of the scalar Kalman filters.
+ ********************************************************************************/
+#include "kalman_filter.h"
+
+namespace ml
+{
+namespace
+{
+
+constexpr uint8_t FractionalBits{8U};
+constexpr int32_t One{1L << FractionalBits};
+constexpr int32_t Half{One / 2};
+
+// -----------------------------------------------------------------------------
+uint32_t scale(const uint32_t value, const int32_t factor)
+{
+    return (value >> FractionalBits) * factor + 
+        (((value & (One - 1U)) * factor) >> FractionalBits);
+}
+
+} // namespace
+
+// -----------------------------------------------------------------------------
+KalmanFilter::KalmanFilter(const double processNoise, const double measurementNoise)
+    : myProcessNoise{processNoise}
+    , myMeasurementNoise{measurementNoise}
+{
+}
+
+// -----------------------------------------------------------------------------
+double KalmanFilter::update(const double measurement)
+{
+    if (!myInitialized)
+    {
+        myEstimate = measurement;
+        myVariance = myMeasurementNoise;
+        myInitialized = true;
+        return myEstimate;
+    }
+    myVariance += myProcessNoise;
+    const double gain{myVariance / (myVariance + myMeasurementNoise)};
+    myEstimate += gain * (measurement - myEstimate);
+    myVariance *= 1.0 - gain;
+    return myEstimate;
+}
+
+// -----------------------------------------------------------------------------
+double KalmanFilter::estimate() const { return myEstimate; }
+
+// -----------------------------------------------------------------------------
+void KalmanFilter::reset() { myInitialized = false; }
+
+// -----------------------------------------------------------------------------
+FixedKalmanFilter::FixedKalmanFilter(const uint16_t processNoise,
+                                     const uint16_t measurementNoise)
+    : myProcessNoise{processNoise}
+    , myMeasurementNoise{measurementNoise}
+{
+}
+
+// -----------------------------------------------------------------------------
+int32_t FixedKalmanFilter::update(const int32_t measurement)
+{
+    const int32_t scaled{measurement * One};
+
+    if (!myInitialized)
+    {
+        myEstimate = scaled;
+        myVariance = static_cast<uint32_t>(myMeasurementNoise) << FractionalBits;
+        myInitialized = true;
+        return estimate();
+    }
+
+    // The gain is kept with 8 fractional bits, i.e. in the range 0 - 256.
+    myVariance += static_cast<uint32_t>(myProcessNoise) << FractionalBits;
+    uint32_t variance{myVariance};
+    uint32_t total{myVariance + (static_cast<uint32_t>(myMeasurementNoise) << FractionalBits)};
+
+    while (variance >= (1UL << (32U - FractionalBits)))
+    {
+        variance >>= 1U;
+        total >>= 1U;
+    }
+    const int32_t gain{total > 0U ? static_cast<int32_t>((variance << FractionalBits) / total) : One};
+
+    myEstimate += (scaled - myEstimate) * gain / One;
+    myVariance = scale(myVariance, One - gain);
+    return estimate();
+}
+
+// -----------------------------------------------------------------------------
+int32_t FixedKalmanFilter::estimate() const
+{
+    return myEstimate >= 0 ? (myEstimate + Half) / One : (myEstimate - Half) / One;
+}
+
+// -----------------------------------------------------------------------------
+void FixedKalmanFilter::reset() { myInitialized = false; }
+
+} // namespace ml
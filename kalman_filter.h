@@ -0,0 +1,112 @@
+/********************************************************************************
+ * @brief Scalar Kalman filters for smoothing noisy measurements, such as
+ *        predicted temperatures, in constant time per sample.
+ ********************************************************************************/
+#pragma once
+
+#include <stdint.h>
+
+namespace ml
+{
+
+/********************************************************************************
+ * @brief Class for scalar Kalman filters using floating-point arithmetic. The
+ *        filtered quantity is modeled as a random walk with specified process
+ *        noise, observed with specified measurement noise.
+ ********************************************************************************/
+class KalmanFilter
+{
+public:
+
+    /********************************************************************************
+     * @brief Creates new Kalman filter.
+     *
+     * @param processNoise     Variance of the change of the quantity per sample.
+     * @param measurementNoise Variance of the measurement noise.
+     ********************************************************************************/
+    KalmanFilter(const double processNoise, const double measurementNoise);
+
+    /********************************************************************************
+     * @brief Updates the filter with a new measurement. The first measurement
+     *        is taken as the initial estimate.
+     *
+     * @param measurement The new measurement.
+     *
+     * @return The updated estimate.
+     ********************************************************************************/
+    double update(const double measurement);
+
+    /********************************************************************************
+     * @brief Provides the current estimate.
+     *
+     * @return The current estimate.
+     ********************************************************************************/
+    double estimate() const;
+
+    /********************************************************************************
+     * @brief Resets the filter, so that the next measurement is taken as the
+     *        initial estimate.
+     ********************************************************************************/
+    void reset();
+
+private:
+    double myEstimate{};
+    double myVariance{};
+    double myProcessNoise;
+    double myMeasurementNoise;
+    bool myInitialized{false};
+};
+
+/********************************************************************************
+ * @brief Class for scalar Kalman filters using integer arithmetic only, for
+ *        integer measurements such as tenths of a degree. The estimate and the
+ *        variances are kept with 8 fractional bits.
+ *
+ * @note Measurements must stay within +/-8191 to avoid overflow.
+ ********************************************************************************/
+class FixedKalmanFilter
+{
+public:
+
+    /********************************************************************************
+     * @brief Creates new fixed-point Kalman filter.
+     *
+     * @param processNoise     Variance of the change of the quantity per sample,
+     *                         in squared measurement units.
+     * @param measurementNoise Variance of the measurement noise, in squared
+     *                         measurement units.
+     ********************************************************************************/
+    FixedKalmanFilter(const uint16_t processNoise, const uint16_t measurementNoise);
+
+    /********************************************************************************
+     * @brief Updates the filter with a new measurement. The first measurement
+     *        is taken as the initial estimate.
+     *
+     * @param measurement The new measurement.
+     *
+     * @return The updated estimate, rounded to nearest.
+     ********************************************************************************/
+    int32_t update(const int32_t measurement);
+
+    /********************************************************************************
+     * @brief Provides the current estimate.
+     *
+     * @return The current estimate, rounded to nearest.
+     ********************************************************************************/
+    int32_t estimate() const;
+
+    /********************************************************************************
+     * @brief Resets the filter, so that the next measurement is taken as the
+     *        initial estimate.
+     ********************************************************************************/
+    void reset();
+
+private:
+    int32_t myEstimate{};
+    uint32_t myVariance{};
+    uint16_t myProcessNoise;
+    uint16_t myMeasurementNoise;
+    bool myInitialized{false};
+};
+
+} // namespace ml
@@ -0,0 +1,182 @@
+/********************************************************************************
+ * @brief Direct least squares solvers for linear regression models with
+ *        several features.
+ ********************************************************************************/
+#pragma once
+
+#include "array.h"
+
+namespace ml
+{
+
+/********************************************************************************
+ * @brief Predicts the output of a multivariate linear model.
+ *
+ * @tparam Features The number of features.
+ *
+ * @param coefficients Reference to the coefficients of the model, the bias
+ *                     followed by one weight per feature.
+ * @param features     Reference to the feature values.
+ *
+ * @return Predicted output value.
+ ********************************************************************************/
+template <size_t Features>
+double predictLinear(const container::Array<double, Features + 1U>& coefficients,
+                     const container::Array<double, Features>& features);
+
+/********************************************************************************
+ * @brief Class for solving least squares problems via the normal equations.
+ *        Each sample is folded into X^T * X and X^T * y, so the memory use is
+ *        independent of the number of samples, and the coefficients are
+ *        solved with a Cholesky decomposition. Fast, but only suitable for
+ *        well-conditioned problems, since the normal equations square the
+ *        condition number.
+ *
+ * @tparam Features The number of features, a bias is added implicitly.
+ *
+ * @note The number of features must exceed 0, else a compilation error will
+ *       be generated.
+ ********************************************************************************/
+template <size_t Features>
+class CholeskySolver
+{
+public:
+    /** Number of coefficients, i.e. the bias and one weight per feature. */
+    static constexpr size_t CoefficientCount{Features + 1U};
+
+    /********************************************************************************
+     * @brief Creates solver without any samples.
+     ********************************************************************************/
+    CholeskySolver() = default;
+
+    /********************************************************************************
+     * @brief Adds a sample to the normal equations.
+     *
+     * @param features Reference to the feature values of the sample.
+     * @param output   The output value of the sample.
+     ********************************************************************************/
+    void add(const container::Array<double, Features>& features, const double output);
+
+    /********************************************************************************
+     * @brief Removes all samples.
+     ********************************************************************************/
+    void clear();
+
+    /********************************************************************************
+     * @brief Provides the number of added samples.
+     *
+     * @return The number of added samples.
+     ********************************************************************************/
+    uint32_t count() const;
+
+    /********************************************************************************
+     * @brief Solves the least squares problem for the added samples.
+     *
+     * @param coefficients Reference to array for storing the coefficients, the
+     *                     bias followed by one weight per feature.
+     *
+     * @return True if the coefficients were solved, false if X^T * X isn't
+     *         numerically positive definite, e.g. if a feature doesn't vary,
+     *         features are (nearly) collinear or there are fewer samples than
+     *         coefficients. A pivot counts as zero below the largest diagonal
+     *         entry times the number of coefficients times the machine epsilon.
+     ********************************************************************************/
+    bool solve(container::Array<double, CoefficientCount>& coefficients) const;
+
+private:
+    static_assert(Features > 0U, "Solver must have at least one feature!");
+    static constexpr size_t index(const size_t row, const size_t column);
+
+    // Lower triangle of X^T * X, stored row by row.
+    container::Array<double, CoefficientCount * (CoefficientCount + 1U) / 2U> myGram{};
+    container::Array<double, CoefficientCount> myMoments{};
+    uint32_t myCount{};
+};
+
+/********************************************************************************
+ * @brief Class for solving least squares problems via Householder QR
+ *        decomposition, which works on X directly and is hence suited for
+ *        ill-conditioned problems. Samples are buffered in blocks of
+ *        BlockRows rows, and each full block is folded into the triangular
+ *        factor R (and Q^T * y) with Householder reflections, so the memory
+ *        use is independent of the number of samples.
+ *
+ * @tparam Features  The number of features, a bias is added implicitly.
+ * @tparam BlockRows The number of samples per block (default = 4).
+ *
+ * @note The number of features and block rows must exceed 0, else a
+ *       compilation error will be generated.
+ ********************************************************************************/
+template <size_t Features, size_t BlockRows = 4U>
+class QrSolver
+{
+public:
+    /** Number of coefficients, i.e. the bias and one weight per feature. */
+    static constexpr size_t CoefficientCount{Features + 1U};
+
+    /********************************************************************************
+     * @brief Creates solver without any samples.
+     ********************************************************************************/
+    QrSolver() = default;
+
+    /********************************************************************************
+     * @brief Adds a sample. The sample is folded into the decomposition once
+     *        its block is full.
+     *
+     * @param features Reference to the feature values of the sample.
+     * @param output   The output value of the sample.
+     ********************************************************************************/
+    void add(const container::Array<double, Features>& features, const double output);
+
+    /********************************************************************************
+     * @brief Removes all samples.
+     ********************************************************************************/
+    void clear();
+
+    /********************************************************************************
+     * @brief Provides the number of added samples.
+     *
+     * @return The number of added samples.
+     ********************************************************************************/
+    uint32_t count() const;
+
+    /********************************************************************************
+     * @brief Solves the least squares problem for the added samples. Buffered
+     *        samples are folded into the decomposition first.
+     *
+     * @param coefficients Reference to array for storing the coefficients, the
+     *                     bias followed by one weight per feature.
+     *
+     * @return True if the coefficients were solved, false if X is numerically
+     *         rank deficient, e.g. if a feature doesn't vary, features are
+     *         (nearly) collinear or there are fewer samples than coefficients.
+     *         A diagonal entry of R counts as zero below the largest column
+     *         norm times the number of coefficients times the machine epsilon.
+     ********************************************************************************/
+    bool solve(container::Array<double, CoefficientCount>& coefficients);
+
+    /********************************************************************************
+     * @brief Provides the residual sum of squares of the least squares fit of
+     *        the samples folded into the decomposition so far.
+     *
+     * @return The sum of the squared residuals.
+     ********************************************************************************/
+    double residual() const;
+
+private:
+    static_assert(Features > 0U, "Solver must have at least one feature!");
+    static_assert(BlockRows > 0U, "Solver must have at least one row per block!");
+    static constexpr size_t Columns{CoefficientCount + 1U};
+    void fold();
+
+    // R and Q^T * y side by side, i.e. R is row-major with an extra column.
+    container::Array<double, CoefficientCount * Columns> myFactor{};
+    container::Array<double, BlockRows * Columns> myBlock{};
+    double myResidual{};
+    uint32_t myCount{};
+    size_t myBlockCount{};
+};
+
+} // namespace ml
+
+#include "least_squares_impl.h"
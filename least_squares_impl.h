@@ -0,0 +1,228 @@
+/********************************************************************************
+ * @brief Implementation details of the least squares solvers.
+ *
+ * @note Don't include this header, use <least_squares.h> instead!
+ ********************************************************************************/
+#pragma once
+
+#include <float.h>
+#include <math.h>
+
+namespace ml
+{
+
+// -----------------------------------------------------------------------------
+template <size_t Features>
+double predictLinear(const container::Array<double, Features + 1U>& coefficients,
+                     const container::Array<double, Features>& features)
+{
+    double output{coefficients[0U]};
+    for (size_t i{}; i < Features; ++i)
+    {
+        output += coefficients[i + 1U] * features[i];
+    }
+    return output;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t Features>
+constexpr size_t CholeskySolver<Features>::index(const size_t row, const size_t column)
+{
+    return row * (row + 1U) / 2U + column;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t Features>
+void CholeskySolver<Features>::add(const container::Array<double, Features>& features,
+                                   const double output)
+{
+    // Row i of X is [1, features], so the products are formed on the fly.
+    for (size_t i{}; i < CoefficientCount; ++i)
+    {
+        const double rowValue{i == 0U ? 1.0 : features[i - 1U]};
+        for (size_t j{}; j <= i; ++j)
+        {
+            myGram[index(i, j)] += rowValue * (j == 0U ? 1.0 : features[j - 1U]);
+        }
+        myMoments[i] += rowValue * output;
+    }
+    myCount++;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t Features>
+void CholeskySolver<Features>::clear()
+{
+    myGram.clear();
+    myMoments.clear();
+    myCount = 0U;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t Features>
+uint32_t CholeskySolver<Features>::count() const { return myCount; }
+
+// -----------------------------------------------------------------------------
+template <size_t Features>
+bool CholeskySolver<Features>::solve(container::Array<double, CoefficientCount>& coefficients) const
+{
+    // Pivots are compared against the scale of X^T * X, since rounding leaves
+    // tiny nonzero pivots for singular matrices.
+    double maxDiagonal{};
+    for (size_t i{}; i < CoefficientCount; ++i)
+    {
+        if (myGram[index(i, i)] > maxDiagonal) { maxDiagonal = myGram[index(i, i)]; }
+    }
+    const double tolerance{DBL_EPSILON * maxDiagonal * CoefficientCount};
+
+    // Decomposes X^T * X = L * L^T in place of a copy of the lower triangle.
+    auto lower{myGram};
+    for (size_t i{}; i < CoefficientCount; ++i)
+    {
+        for (size_t j{}; j <= i; ++j)
+        {
+            double sum{lower[index(i, j)]};
+            for (size_t k{}; k < j; ++k)
+            {
+                sum -= lower[index(i, k)] * lower[index(j, k)];
+            }
+            if (i == j)
+            {
+                if (sum <= tolerance) { return false; }
+                lower[index(i, i)] = sqrt(sum);
+            }
+            else
+            {
+                lower[index(i, j)] = sum / lower[index(j, j)];
+            }
+        }
+    }
+
+    // Solves L * z = X^T * y, then L^T * coefficients = z.
+    for (size_t i{}; i < CoefficientCount; ++i)
+    {
+        double sum{myMoments[i]};
+        for (size_t k{}; k < i; ++k) { sum -= lower[index(i, k)] * coefficients[k]; }
+        coefficients[i] = sum / lower[index(i, i)];
+    }
+    for (size_t i{CoefficientCount}; i-- > 0U;)
+    {
+        double sum{coefficients[i]};
+        for (size_t k{i + 1U}; k < CoefficientCount; ++k) { sum -= lower[index(k, i)] * coefficients[k]; }
+        coefficients[i] = sum / lower[index(i, i)];
+    }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t Features, size_t BlockRows>
+void QrSolver<Features, BlockRows>::add(const container::Array<double, Features>& features,
+                                        const double output)
+{
+    double* row{myBlock.data() + myBlockCount * Columns};
+    row[0U] = 1.0;
+    for (size_t i{}; i < Features; ++i) { row[i + 1U] = features[i]; }
+    row[CoefficientCount] = output;
+    myCount++;
+    if (++myBlockCount == BlockRows) { fold(); }
+}
+
+// -----------------------------------------------------------------------------
+template <size_t Features, size_t BlockRows>
+void QrSolver<Features, BlockRows>::clear()
+{
+    myFactor.clear();
+    myResidual = 0.0;
+    myCount = 0U;
+    myBlockCount = 0U;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t Features, size_t BlockRows>
+uint32_t QrSolver<Features, BlockRows>::count() const { return myCount; }
+
+// -----------------------------------------------------------------------------
+template <size_t Features, size_t BlockRows>
+bool QrSolver<Features, BlockRows>::solve(container::Array<double, CoefficientCount>& coefficients)
+{
+    fold();
+
+    // The columns of R have the norms of the columns of X, which give the
+    // scale that the diagonal entries are compared against.
+    double maxNorm{};
+    for (size_t j{}; j < CoefficientCount; ++j)
+    {
+        double norm{};
+        for (size_t i{}; i <= j; ++i)
+        {
+            const double value{myFactor[i * Columns + j]};
+            norm += value * value;
+        }
+        if (norm > maxNorm) { maxNorm = norm; }
+    }
+    const double tolerance{DBL_EPSILON * sqrt(maxNorm) * CoefficientCount};
+
+    for (size_t i{CoefficientCount}; i-- > 0U;)
+    {
+        const double* row{myFactor.data() + i * Columns};
+        if (fabs(row[i]) <= tolerance) { return false; }
+        double sum{row[CoefficientCount]};
+        for (size_t k{i + 1U}; k < CoefficientCount; ++k) { sum -= row[k] * coefficients[k]; }
+        coefficients[i] = sum / row[i];
+    }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t Features, size_t BlockRows>
+double QrSolver<Features, BlockRows>::residual() const { return myResidual; }
+
+// -----------------------------------------------------------------------------
+template <size_t Features, size_t BlockRows>
+void QrSolver<Features, BlockRows>::fold()
+{
+    // Triangularizes [R; block] column by column. R is zero below its diagonal,
+    // so each reflection only touches row j of R and the rows of the block.
+    for (size_t j{}; j < CoefficientCount && myBlockCount > 0U; ++j)
+    {
+        double* pivotRow{myFactor.data() + j * Columns};
+        double norm{pivotRow[j] * pivotRow[j]};
+        for (size_t r{}; r < myBlockCount; ++r)
+        {
+            const double value{myBlock[r * Columns + j]};
+            norm += value * value;
+        }
+        if (norm <= 0.0) { continue; }
+        norm = sqrt(norm);
+
+        const double alpha{pivotRow[j] > 0.0 ? -norm : norm};
+        const double head{pivotRow[j] - alpha};
+        const double scale{1.0 / (norm * norm - alpha * pivotRow[j])};
+
+        for (size_t k{j + 1U}; k < Columns; ++k)
+        {
+            double dot{head * pivotRow[k]};
+            for (size_t r{}; r < myBlockCount; ++r)
+            {
+                dot += myBlock[r * Columns + j] * myBlock[r * Columns + k];
+            }
+            dot *= scale;
+            pivotRow[k] -= dot * head;
+            for (size_t r{}; r < myBlockCount; ++r)
+            {
+                myBlock[r * Columns + k] -= dot * myBlock[r * Columns + j];
+            }
+        }
+        pivotRow[j] = alpha;
+    }
+
+    // What remains of the outputs of the block is orthogonal to the columns of X.
+    for (size_t r{}; r < myBlockCount; ++r)
+    {
+        const double value{myBlock[r * Columns + CoefficientCount]};
+        myResidual += value * value;
+    }
+    myBlockCount = 0U;
+}
+
+} // namespace ml
@@ -0,0 +1,125 @@
+/********************************************************************************
+ * @brief Implementation details of the logistic regression classifier.
+ ********************************************************************************/
+#include <math.h>
+
+#include "log_reg.h"
+
+#ifdef __AVR__
+#include <avr/pgmspace.h>
+#endif
+
+namespace ml
+{
+namespace
+{
+
+#ifdef __AVR__
+
+constexpr double TableMin{-8.0};
+constexpr double TableMax{8.0};
+constexpr double TableStep{0.5};
+constexpr double TableScale{65535.0};
+
+/********************************************************************************
+ * @brief Values of the logistic function for x = -8, -7.5, ..., 8, scaled to
+ *        the range 0 - 65535.
+ ********************************************************************************/
+const uint16_t SigmoidTable[] PROGMEM
+{
+       22U,    36U,    60U,    98U,   162U,   267U,   439U,   720U,
+     1179U,  1921U,  3108U,  4971U,  7812U, 11955U, 17625U, 24742U,
+    32768U, 40793U, 47910U, 53580U, 57723U, 60564U, 62427U, 63614U,
+    64356U, 64815U, 65096U, 65268U, 65373U, 65437U, 65475U, 65499U,
+    65513U,
+};
+
+#endif
+
+} // namespace
+
+// -----------------------------------------------------------------------------
+double sigmoid(const double x)
+{
+#ifdef __AVR__
+    if (x <= TableMin) { return 0.0; }
+    if (x >= TableMax) { return 1.0; }
+    const double position{(x - TableMin) / TableStep};
+    const uint8_t index{static_cast<uint8_t>(position)};
+    const double fraction{position - index};
+    const double lower{static_cast<double>(pgm_read_word(&SigmoidTable[index]))};
+    const double upper{static_cast<double>(pgm_read_word(&SigmoidTable[index + 1U]))};
+    return (lower + (upper - lower) * fraction) / TableScale;
+#else
+    return 1.0 / (1.0 + exp(-x));
+#endif
+}
+
+// -----------------------------------------------------------------------------
+LogReg::LogReg(const double bias, const double weight, const Dataset& trainingData,
+               const double learningRate)
+    : myBias{bias}
+    , myWeight{weight}
+    , myLearningRate{learningRate}
+    , myTrainingData{trainingData}
+{
+}
+
+// -----------------------------------------------------------------------------
+double LogReg::getBias() const { return myBias; }
+
+// -----------------------------------------------------------------------------
+double LogReg::getWeight() const { return myWeight; }
+
+// -----------------------------------------------------------------------------
+void LogReg::setCoefficients(const double bias, const double weight)
+{
+    myBias = bias;
+    myWeight = weight;
+}
+
+// -----------------------------------------------------------------------------
+const Dataset& LogReg::getTrainingData() const { return myTrainingData; }
+
+// -----------------------------------------------------------------------------
+uint32_t LogReg::getTrainingSetCount() const { return myTrainingData.count(); }
+
+// -----------------------------------------------------------------------------
+double LogReg::predict(const double input) const
+{
+    return sigmoid(myBias + myWeight * input);
+}
+
+// -----------------------------------------------------------------------------
+void LogReg::setThreshold(const double threshold)
+{
+    if (threshold <= 0.0) { myThresholdScore = -INFINITY; }
+    else if (threshold >= 1.0) { myThresholdScore = INFINITY; }
+    else { myThresholdScore = log(threshold / (1.0 - threshold)); }
+}
+
+// -----------------------------------------------------------------------------
+bool LogReg::classify(const double input) const
+{
+    return myBias + myWeight * input >= myThresholdScore;
+}
+
+// -----------------------------------------------------------------------------
+bool LogReg::train(const uint16_t epochs)
+{
+    if (epochs == 0U || myLearningRate <= 0.0) { return false; }
+
+    for (uint16_t i{}; i < epochs; ++i)
+    {
+        for (uint32_t j{}; j < myTrainingData.count(); ++j)
+        {
+            const double input{myTrainingData.input()[j]};
+            const double error{(myTrainingData.output()[j] - predict(input)) * myLearningRate};
+            myBias += error;
+            myWeight += error * input;
+        }
+    }
+    return true;
+}
+
+} // namespace ml
@@ -0,0 +1,130 @@
+/********************************************************************************
+ * @brief Logistic regression classifier for threshold decisions on sensor data.
+ ********************************************************************************/
+#pragma once
+
+#include "dataset.h"
+
+namespace ml
+{
+
+/********************************************************************************
+ * @brief Calculates the logistic function 1 / (1 + e^-x). On AVR the function
+ *        is interpolated from a lookup table in program memory, which avoids
+ *        the exponential function entirely, elsewhere it's calculated exactly.
+ *
+ * @param x The input value.
+ *
+ * @return The logistic function of the input value, in the range 0 - 1.
+ ********************************************************************************/
+double sigmoid(const double x);
+
+/********************************************************************************
+ * @brief Class for logistic regression models, predicting the probability
+ *        that the output is 1 for a given input. The model trains on the same
+ *        dataset views as LinReg, with output values 0 and 1 as class labels.
+ ********************************************************************************/
+class LogReg
+{
+public:
+
+    /********************************************************************************
+     * @brief Creates new logistic regression model.
+     *
+     * @param bias         Initial bias value.
+     * @param weight       Initial weight value.
+     * @param trainingData View of the training data, with output values 0 or 1.
+     * @param learningRate Learning rate for the model (default = 0.01).
+     *
+     * @note The training data is viewed, not copied, so it must outlive the
+     *       model.
+     ********************************************************************************/
+    LogReg(const double bias, const double weight, const Dataset& trainingData,
+           const double learningRate = 0.01);
+
+    /********************************************************************************
+     * @brief Provides the current bias value.
+     *
+     * @return The bias as a double.
+     ********************************************************************************/
+    double getBias() const;
+
+    /********************************************************************************
+     * @brief Provides the current weight value.
+     *
+     * @return The weight as a double.
+     ********************************************************************************/
+    double getWeight() const;
+
+    /********************************************************************************
+     * @brief Sets the bias and weight values, e.g. when restoring a stored model.
+     *
+     * @param bias   New bias value.
+     * @param weight New weight value.
+     ********************************************************************************/
+    void setCoefficients(const double bias, const double weight);
+
+    /********************************************************************************
+     * @brief Provides the training data of the model.
+     *
+     * @return View of the training data.
+     ********************************************************************************/
+    const Dataset& getTrainingData() const;
+
+    /********************************************************************************
+     * @brief Provides the number of training sets.
+     *
+     * @return The number of training sets.
+     ********************************************************************************/
+    uint32_t getTrainingSetCount() const;
+
+    /********************************************************************************
+     * @brief Predicts the probability that the output is 1 for given input.
+     *
+     * @param input Input value for prediction.
+     *
+     * @return The predicted probability, in the range 0 - 1.
+     ********************************************************************************/
+    double predict(const double input) const;
+
+    /********************************************************************************
+     * @brief Sets the classification threshold. The threshold is converted to
+     *        a linear score (logit) once, so classification needs neither a
+     *        sigmoid nor a logarithm. The default threshold is 0.5.
+     *
+     * @param threshold The probability from which input is classified as 1.
+     *                  A threshold of 0 or less classifies all input as 1, a
+     *                  threshold of 1 or more classifies all input as 0.
+     ********************************************************************************/
+    void setThreshold(const double threshold);
+
+    /********************************************************************************
+     * @brief Classifies given input by comparing its linear score against the
+     *        score of the classification threshold.
+     *
+     * @param input Input value to classify.
+     *
+     * @return True if the input is classified as 1, else false.
+     ********************************************************************************/
+    bool classify(const double input) const;
+
+    /********************************************************************************
+     * @brief Trains the model with stochastic gradient descent on the
+     *        cross-entropy loss.
+     *
+     * @param epochs The number of epochs to train the model.
+     *
+     * @return True if training was performed, false if the number of epochs
+     *         or the learning rate is invalid.
+     ********************************************************************************/
+    bool train(const uint16_t epochs);
+
+private:
+    double myBias;
+    double myWeight;
+    double myLearningRate;
+    double myThresholdScore{};
+    Dataset myTrainingData;
+};
+
+} // namespace ml
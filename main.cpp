@@ -1,10 +1,27 @@
 /********************************************************************************
  * @brief Temperature prediction system in C++
+ * 
+ * @note Build options:
+ * - Define EXPORT_MODEL to print the trained model as a header via serial
+ *   transmission at startup.
+ * - Define BAKED_MODEL to use the model of such a header, saved as 
+ *   baked_model.h, instead. No training code is then linked into the image.
  ********************************************************************************/
 
 #include "adc.h"
 #include "gpio.h"
+#include "kalman_filter.h"
+#include "quantized_lin_reg.h"
+#ifdef BAKED_MODEL
+#include "baked_model.h"
+#else
 #include "LinReg.h" 
+#include "model_store.h"
+#include "small_vector.h"
+#ifdef EXPORT_MODEL
+#include "model_export.h"
+#endif
+#endif
 #include "timer.h"
 #include "serial.h"
 #include "watchdog.h"
@@ -18,9 +35,15 @@ namespace
  *
  * @param tempSensorPin The analog pin to read the temperature sensor.
  * @param Vcc The supply voltage of the temperature sensor.
+ * @param modelAddress The EEPROM address of the stored model.
+ * @param trainingEpochs The number of epochs to train the model.
  ********************************************************************************/
 constexpr uint8_t tempSensorPin{2};
 constexpr double Vcc{5.0};          
+#ifndef BAKED_MODEL
+constexpr uint16_t modelAddress{0};
+constexpr int trainingEpochs{40};
+#endif
 
 /********************************************************************************
  * @brief Devices used in the embedded system.
@@ -36,38 +59,62 @@ GPIO predictionButton{13, GPIO::Direction::InputPullup};
 Timer debounceTimer{Timer::Circuit::Timer0, 300};        
 Timer predictionTimer{Timer::Circuit::Timer1, 60000}; 
 
+#ifndef BAKED_MODEL
 /********************************************************************************
- * @brief Linear regression model and training data.
+ * @brief Linear regression model and training data. The training data is 
+ *        stored inline, so no heap memory is allocated at startup.
  *
+ * @param trainingSetCapacity The number of training samples stored inline.
  * @param trainingInput Vector of training input values.
  * @param trainingOutput Vector of training output values.
  * @param linReg Linear regression model used to predict the temperature.
  ********************************************************************************/
-const container::Vector<double> trainingInput{0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0};
-const container::Vector<double> trainingOutput{-50, -40, -30, -20, -10, 0, 10, 20, 30, 40, 50}; 
-ml::LinReg linReg{0.0, 0.0, trainingInput, trainingOutput, 0.1};
-    
+constexpr size_t trainingSetCapacity{11};
+const container::SmallVector<double, trainingSetCapacity> trainingInput{0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0};
+const container::SmallVector<double, trainingSetCapacity> trainingOutput{-50, -40, -30, -20, -10, 0, 10, 20, 30, 40, 50}; 
+ml::LinReg linReg{0.0, 0.0, ml::Dataset{trainingInput.data(), trainingOutput.data(), trainingInput.size()}, 0.1};
+
 /********************************************************************************
- * @brief Reads the input voltage from the temperature sensor.
+ * @brief Integer-only version of the linear regression model.
  *
- * @param pin The analog pin to read (A0 - A5 / PORTC0 - PORTC5).
+ * @param quantizedScaling Maps ADC codes to volts (the model input) and the 
+ *                         model output to tenths of a degree, with an error
+ *                         of at most 0.1 degrees over the full ADC range.
+ * @param quantizedLinReg Quantized model used to predict the temperature.
+ ********************************************************************************/
+constexpr ml::QuantizedLinReg::Scaling quantizedScaling{Vcc / adc::MaxVal, 10.0, 
+                                                        adc::MaxVal, 16, 1.0};
+ml::QuantizedLinReg quantizedLinReg{};
+#else
+/********************************************************************************
+ * @brief Integer-only linear regression model baked into the firmware.
  *
- * @return The input voltage in volts.
+ * @param quantizedLinReg Quantized model used to predict the temperature.
  ********************************************************************************/
-double inputVoltage(const uint8_t pin) 
-{
-    return adc::getDutyCycle(pin) * Vcc;
-}
+constexpr ml::QuantizedLinReg quantizedLinReg{baked_model::Quantized};
+#endif
+
+/********************************************************************************
+ * @brief Kalman filter smoothing the predicted temperature in tenths of a 
+ *        degree. One ADC code corresponds to about half a degree, which gives
+ *        a measurement noise variance of about 25 tenths squared.
+ *
+ * @param temperatureFilter Fixed-point Kalman filter for the temperature.
+ ********************************************************************************/
+ml::FixedKalmanFilter temperatureFilter{1, 25};
 
 /********************************************************************************
- * @brief Predicts the temperature based on the input voltage.
+ * @brief Predicts the temperature based on the ADC code read from the 
+ *        temperature sensor, using integer arithmetic only. The prediction is
+ *        smoothed by the Kalman filter before it's printed.
  ********************************************************************************/
 void predictTemperature()
 {
-    const auto input{inputVoltage(tempSensorPin)};
-    const auto prediction{linReg.predict(input)};
-    const int temperature{prediction >= 0 ? prediction + 0.5 : prediction - 0.5};
-    serial::printf("Temp: %d\n", temperature);
+    const auto prediction{quantizedLinReg.predict(adc::read(tempSensorPin))};
+    const auto tenths{temperatureFilter.update(prediction)};
+    const auto magnitude{tenths < 0 ? -tenths : tenths};
+    serial::printf("Temp: %s%ld.%ld\n", tenths < 0 ? "-" : "", 
+                   magnitude / 10, magnitude % 10);
 }
 
 /********************************************************************************
@@ -110,18 +157,42 @@ void predictionTimerCallback(void)
 /********************************************************************************
  * @brief Sets callback routines, enabled pin change interrupt on 
  *        predictionButton and enables the watchdog timer in system reset mode. 
- *        Trains the linear regression model.
+ *        Restores the linear regression model from EEPROM, or trains and stores
+ *        it if no valid model trained on the current training data is stored.
+ *        The error LED is lit if the training input and output don't match.
+ *        The model is then quantized for integer-only prediction.
  ********************************************************************************/
 inline void setup(void) 
 {
     adc::init();
     serial::init();
 
-    if (!linReg.train(40))
+#ifndef BAKED_MODEL
+    if (trainingInput.size() != trainingOutput.size())
+    {
+        errorLed.set();
+        return;
+    }
+
+    if (!ml::model_store::load(modelAddress, linReg))
+    {
+        if (!linReg.train(trainingEpochs))
+        {
+            errorLed.set();
+            return;
+        }
+        ml::model_store::save(modelAddress, linReg);
+    }
+
+    if (!ml::QuantizedLinReg::quantize(linReg, quantizedScaling, quantizedLinReg))
     {
         errorLed.set();
         return;
     }
+#ifdef EXPORT_MODEL
+    ml::model_export::print(linReg, quantizedLinReg);
+#endif
+#endif
     
     predictionButton.addCallback(buttonCallback);
     debounceTimer.addCallback(debounceTimerCallback);
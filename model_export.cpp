@@ -0,0 +1,49 @@
+/********************************************************************************
+ * @brief Implementation details of the model export.
+ ********************************************************************************/
+#include <math.h>
+
+#include "model_export.h"
+#include "serial.h"
+
+namespace ml
+{
+namespace model_export
+{
+namespace
+{
+
+constexpr uint8_t MantissaBits{32U};
+
+// -----------------------------------------------------------------------------
+bool printConstant(const char* name, const double value)
+{
+    // printf lacks %f support on AVR, hence the value is printed as a 
+    // hexadecimal floating-point literal (mantissa * 2^exponent), which is 
+    // also exact.
+    int exponent{};
+    const double fraction{frexp(value < 0.0 ? -value : value, &exponent)};
+    const auto mantissa{static_cast<unsigned long>(ldexp(fraction, MantissaBits))};
+    return driver::serial::printf("constexpr double %s{%s0x%lXp%d};\n", name, value < 0.0 ? "-" : "",
+                          mantissa, exponent - static_cast<int>(MantissaBits));
+}
+
+} // namespace
+
+// -----------------------------------------------------------------------------
+bool print(const LinReg& model, const QuantizedLinReg& quantized)
+{
+    return driver::serial::printf("// Generated by ml::model_export::print, don't edit!\n"
+                          "#pragma once\n\n#include \"quantized_lin_reg.h\"\n\n"
+                          "namespace baked_model\n{\n\n") &&
+        printConstant("Bias", model.getBias()) &&
+        printConstant("Weight", model.getWeight()) &&
+        printConstant("QuantizedErrorBound", quantized.errorBound()) &&
+        driver::serial::printf("constexpr ml::QuantizedLinReg Quantized{%ld, %ld, %u, "
+                       "QuantizedErrorBound};\n\n} // namespace baked_model\n",
+                       static_cast<long>(quantized.bias()), static_cast<long>(quantized.weight()),
+                       static_cast<unsigned>(quantized.shift()));
+}
+
+} // namespace model_export
+} // namespace ml
@@ -0,0 +1,33 @@
+/********************************************************************************
+ * @brief Export of trained models as C++ headers, so that a model trained once
+ *        can be baked into the firmware without any training code.
+ ********************************************************************************/
+#pragma once
+
+#include "LinReg.h"
+#include "quantized_lin_reg.h"
+
+namespace ml
+{
+namespace model_export
+{
+
+/********************************************************************************
+ * @brief Prints a header holding referenced models as compile-time constants
+ *        via serial transmission. Capture the output as baked_model.h and build
+ *        with BAKED_MODEL defined to use it. The header defines the following
+ *        constants in namespace baked_model:
+ *
+ *        - Bias and Weight: the coefficients of the floating-point model,
+ *          printed as exact hexadecimal floating-point literals.
+ *        - Quantized: the quantized model as a constexpr QuantizedLinReg.
+ *
+ * @param model     Reference to the floating-point model.
+ * @param quantized Reference to the quantized version of the model.
+ *
+ * @return True if the header was printed, else false.
+ ********************************************************************************/
+bool print(const LinReg& model, const QuantizedLinReg& quantized);
+
+} // namespace model_export
+} // namespace ml
@@ -0,0 +1,111 @@
+/********************************************************************************
+ * @brief Statically sized registry of linear regression models, one per
+ *        analog channel, sharing one training engine.
+ ********************************************************************************/
+#pragma once
+
+#include "array.h"
+#include "dataset.h"
+#include "statistics.h"
+
+namespace ml
+{
+
+/********************************************************************************
+ * @brief Class for registries mapping analog channels to linear regression
+ *        models. The coefficients of all models are stored contiguously, and
+ *        all models are trained by the same closed-form engine, so no model
+ *        needs its own training state, heap memory or virtual dispatch.
+ *
+ * @tparam Channels The number of channels (default = 6 for A0 - A5).
+ *
+ * @note The number of channels must exceed 0, else a compilation error will
+ *       be generated.
+ ********************************************************************************/
+template <size_t Channels = 6U>
+class ModelRegistry
+{
+public:
+
+    /********************************************************************************
+     * @brief Creates registry without any registered models.
+     ********************************************************************************/
+    ModelRegistry() = default;
+
+    /********************************************************************************
+     * @brief Trains the model of specified channel on referenced training data
+     *        and registers it.
+     *
+     * @param channel The channel of the model.
+     * @param data    Reference to the training data.
+     *
+     * @return True if the model was trained, false if the channel is invalid or
+     *         the input values don't vary.
+     ********************************************************************************/
+    bool train(const uint8_t channel, const Dataset& data);
+
+    /********************************************************************************
+     * @brief Registers referenced coefficients as the model of specified channel,
+     *        e.g. when restoring a stored model.
+     *
+     * @param channel      The channel of the model.
+     * @param coefficients Reference to the coefficients of the model.
+     *
+     * @return True if the model was registered, false if the channel is invalid.
+     ********************************************************************************/
+    bool set(const uint8_t channel, const Coefficients& coefficients);
+
+    /********************************************************************************
+     * @brief Removes the model of specified channel.
+     *
+     * @param channel The channel of the model.
+     ********************************************************************************/
+    void remove(const uint8_t channel);
+
+    /********************************************************************************
+     * @brief Indicates if a model is registered for specified channel.
+     *
+     * @param channel The channel to check.
+     *
+     * @return True if a model is registered for the channel, else false.
+     ********************************************************************************/
+    bool isRegistered(const uint8_t channel) const;
+
+    /********************************************************************************
+     * @brief Provides the coefficients of the model of specified channel.
+     *
+     * @param channel The channel of the model.
+     *
+     * @return Reference to the coefficients of the model.
+     ********************************************************************************/
+    const Coefficients& coefficients(const uint8_t channel) const;
+
+    /********************************************************************************
+     * @brief Predicts the output of the model of specified channel.
+     *
+     * @param channel The channel of the model.
+     * @param input   Input value for prediction.
+     *
+     * @return Predicted output value, or 0 if no model is registered.
+     ********************************************************************************/
+    double predict(const uint8_t channel, const double input) const;
+
+    /********************************************************************************
+     * @brief Predicts the outputs of all channels in one pass. Channels without
+     *        a registered model predict 0.
+     *
+     * @param inputs  Reference to the input values, one per channel.
+     * @param outputs Reference to array for storing the predicted values.
+     ********************************************************************************/
+    void predictAll(const container::Array<double, Channels>& inputs,
+                    container::Array<double, Channels>& outputs) const;
+
+private:
+    static_assert(Channels > 0U && Channels <= 32U, "Registry must hold 1 - 32 channels!");
+    container::Array<Coefficients, Channels> myCoefficients{};
+    uint32_t myRegistered{};
+};
+
+} // namespace ml
+
+#include "model_registry_impl.h"
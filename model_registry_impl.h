@@ -0,0 +1,76 @@
+/********************************************************************************
+ * @brief Implementation details of the ml::ModelRegistry class.
+ *
+ * @note Don't include this header, use <model_registry.h> instead!
+ ********************************************************************************/
+#pragma once
+
+namespace ml
+{
+
+// -----------------------------------------------------------------------------
+template <size_t Channels>
+bool ModelRegistry<Channels>::train(const uint8_t channel, const Dataset& data)
+{
+    if (channel >= Channels) { return false; }
+    Statistics statistics{};
+    Coefficients coefficients{};
+    statistics.add(data.input(), data.output(), data.count());
+    if (!statistics.solve(coefficients.bias, coefficients.weight)) { return false; }
+    return set(channel, coefficients);
+}
+
+// -----------------------------------------------------------------------------
+template <size_t Channels>
+bool ModelRegistry<Channels>::set(const uint8_t channel, const Coefficients& coefficients)
+{
+    if (channel >= Channels) { return false; }
+    myCoefficients[channel] = coefficients;
+    myRegistered |= (1UL << channel);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t Channels>
+void ModelRegistry<Channels>::remove(const uint8_t channel)
+{
+    if (channel >= Channels) { return; }
+    myCoefficients[channel] = Coefficients{};
+    myRegistered &= ~(1UL << channel);
+}
+
+// -----------------------------------------------------------------------------
+template <size_t Channels>
+bool ModelRegistry<Channels>::isRegistered(const uint8_t channel) const
+{
+    return channel < Channels && (myRegistered & (1UL << channel));
+}
+
+// -----------------------------------------------------------------------------
+template <size_t Channels>
+const Coefficients& ModelRegistry<Channels>::coefficients(const uint8_t channel) const
+{
+    return myCoefficients[channel];
+}
+
+// -----------------------------------------------------------------------------
+template <size_t Channels>
+double ModelRegistry<Channels>::predict(const uint8_t channel, const double input) const
+{
+    if (channel >= Channels) { return 0.0; }
+    return myCoefficients[channel].bias + myCoefficients[channel].weight * input;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t Channels>
+void ModelRegistry<Channels>::predictAll(const container::Array<double, Channels>& inputs,
+                                         container::Array<double, Channels>& outputs) const
+{
+    // Unregistered channels hold zero coefficients, so no branch is needed.
+    for (size_t i{}; i < Channels; ++i)
+    {
+        outputs[i] = myCoefficients[i].bias + myCoefficients[i].weight * inputs[i];
+    }
+}
+
+} // namespace ml
@@ -0,0 +1,230 @@
+/********************************************************************************
+ * @brief Implementation details of model persistence in EEPROM.
+ ********************************************************************************/
+#include <stddef.h>
+
+#include "eeprom.h"
+#include "model_store.h"
+
+namespace ml
+{
+namespace model_store
+{
+namespace
+{
+
+constexpr uint32_t FnvOffsetBasis{2166136261UL};
+constexpr uint32_t FnvPrime{16777619UL};
+constexpr uint16_t CrcInit{0xFFFFU};
+constexpr uint16_t CrcPolynomial{0x1021U};
+constexpr uint16_t CrcSize{offsetof(Record, crc)};
+constexpr uint16_t CheckpointCrcSize{offsetof(Checkpoint, crc)};
+
+// -----------------------------------------------------------------------------
+uint32_t hashBytes(uint32_t hash, const uint8_t* data, const uint32_t size)
+{
+    for (uint32_t i{}; i < size; ++i)
+    {
+        hash = (hash ^ data[i]) * FnvPrime;
+    }
+    return hash;
+}
+
+// -----------------------------------------------------------------------------
+const uint8_t* bytes(const void* data) { return static_cast<const uint8_t*>(data); }
+
+// -----------------------------------------------------------------------------
+bool readCheckpoint(const uint16_t address, Checkpoint& checkpoint)
+{
+    return driver::eeprom::readBytes(address, reinterpret_cast<uint8_t*>(&checkpoint),
+                                     sizeof(Checkpoint)) &&
+        checkpoint.version == CheckpointVersion &&
+        checkpoint.crc == crc16(bytes(&checkpoint), CheckpointCrcSize);
+}
+
+// -----------------------------------------------------------------------------
+template <typename Model>
+bool saveModel(const uint16_t address, const Kind kind, const Model& model)
+{
+    Record record{};
+    record.kind = kind;
+    record.dataHash = hash(model.getTrainingData());
+    record.bias = model.getBias();
+    record.weight = model.getWeight();
+    return save(address, record);
+}
+
+// -----------------------------------------------------------------------------
+template <typename Model>
+bool loadModel(const uint16_t address, const Kind kind, Model& model)
+{
+    Record record{};
+    if (!load(address, record) || record.kind != kind ||
+        record.dataHash != hash(model.getTrainingData()))
+    {
+        return false;
+    }
+    model.setCoefficients(record.bias, record.weight);
+    return true;
+}
+
+} // namespace
+
+// -----------------------------------------------------------------------------
+uint32_t hash(const Dataset& data)
+{
+    const uint32_t size{data.count() * sizeof(double)};
+    auto hash{hashBytes(FnvOffsetBasis, bytes(data.input()), size)};
+    return hashBytes(hash, bytes(data.output()), size);
+}
+
+// -----------------------------------------------------------------------------
+uint16_t crc16(const uint8_t* data, const uint16_t size)
+{
+    uint16_t crc{CrcInit};
+    for (uint16_t i{}; i < size; ++i)
+    {
+        crc ^= static_cast<uint16_t>(data[i]) << 8U;
+        for (uint8_t bit{}; bit < 8U; ++bit)
+        {
+            crc = crc & 0x8000U ? (crc << 1U) ^ CrcPolynomial : crc << 1U;
+        }
+    }
+    return crc;
+}
+
+// -----------------------------------------------------------------------------
+bool save(const uint16_t address, Record record)
+{
+    record.version = Version;
+    record.crc = crc16(bytes(&record), CrcSize);
+    return driver::eeprom::writeBytes(address, bytes(&record), sizeof(Record));
+}
+
+// -----------------------------------------------------------------------------
+bool load(const uint16_t address, Record& record)
+{
+    Record stored{};
+    if (!driver::eeprom::readBytes(address, reinterpret_cast<uint8_t*>(&stored),
+                                   sizeof(Record)) ||
+        stored.version != Version || stored.crc != crc16(bytes(&stored), CrcSize))
+    {
+        return false;
+    }
+    record = stored;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+bool save(const uint16_t address, const LinReg& model)
+{
+    return saveModel(address, Kind::LinReg, model);
+}
+
+// -----------------------------------------------------------------------------
+bool load(const uint16_t address, LinReg& model)
+{
+    return loadModel(address, Kind::LinReg, model);
+}
+
+// -----------------------------------------------------------------------------
+bool save(const uint16_t address, const LogReg& model)
+{
+    return saveModel(address, Kind::LogReg, model);
+}
+
+// -----------------------------------------------------------------------------
+bool load(const uint16_t address, LogReg& model)
+{
+    return loadModel(address, Kind::LogReg, model);
+}
+
+// -----------------------------------------------------------------------------
+bool loadCheckpoint(const uint16_t address, LinReg& model)
+{
+    Checkpoint first{};
+    Checkpoint second{};
+    const uint32_t dataHash{hash(model.getTrainingData())};
+    const bool firstValid{readCheckpoint(address, first) && first.dataHash == dataHash};
+    const bool secondValid{readCheckpoint(address + sizeof(Checkpoint), second) &&
+                           second.dataHash == dataHash};
+
+    if (!firstValid && !secondValid) { return false; }
+    const bool useSecond{secondValid && (!firstValid || second.sequence > first.sequence)};
+    model.setState(useSecond ? second.state : first.state);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+CheckpointWriter::CheckpointWriter(const uint16_t address, const uint32_t interval)
+    : myInterval{interval > 0U ? interval : 1U}
+    , myAddress{address}
+{
+}
+
+// -----------------------------------------------------------------------------
+bool CheckpointWriter::update(const LinReg& model)
+{
+    if (!busy())
+    {
+        if (model.getSteps() - myLastSteps < myInterval) { return false; }
+        snapshot(model);
+    }
+
+    const auto data{bytes(&myCheckpoint)};
+    while (busy() && driver::eeprom::tryWrite(slotAddress() + myIndex, data[myIndex]))
+    {
+        myIndex++;
+    }
+    return !busy();
+}
+
+// -----------------------------------------------------------------------------
+void CheckpointWriter::flush()
+{
+    if (!busy()) { return; }
+    driver::eeprom::writeBytes(slotAddress() + myIndex, bytes(&myCheckpoint) + myIndex,
+                               sizeof(Checkpoint) - myIndex);
+    myIndex = sizeof(Checkpoint);
+}
+
+// -----------------------------------------------------------------------------
+bool CheckpointWriter::busy() const { return myIndex < sizeof(Checkpoint); }
+
+// -----------------------------------------------------------------------------
+void CheckpointWriter::snapshot(const LinReg& model)
+{
+    // Continues the sequence of checkpoints left by a previous run, if any.
+    if (!myInitialized)
+    {
+        Checkpoint stored{};
+        for (uint8_t slot{}; slot < 2U; ++slot)
+        {
+            if (readCheckpoint(myAddress + slot * sizeof(Checkpoint), stored) &&
+                stored.sequence >= myCheckpoint.sequence)
+            {
+                myCheckpoint.sequence = stored.sequence;
+                mySlot = slot;
+            }
+        }
+        myInitialized = true;
+    }
+
+    mySlot ^= 1U;
+    myCheckpoint.version = CheckpointVersion;
+    myCheckpoint.sequence++;
+    myCheckpoint.dataHash = hash(model.getTrainingData());
+    myCheckpoint.state = model.getState();
+    myCheckpoint.crc = crc16(bytes(&myCheckpoint), CheckpointCrcSize);
+    myLastSteps = model.getSteps();
+    myIndex = 0U;
+}
+
+// -----------------------------------------------------------------------------
+uint16_t CheckpointWriter::slotAddress() const
+{
+    return myAddress + mySlot * sizeof(Checkpoint);
+}
+
+} // namespace model_store
+} // namespace ml
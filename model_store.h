@@ -0,0 +1,232 @@
+/********************************************************************************
+ * @brief Persistence of trained models in EEPROM, so that a model can be
+ *        restored at boot instead of being retrained.
+ ********************************************************************************/
+#pragma once
+
+#include "dataset.h"
+#include "LinReg.h"
+#include "log_reg.h"
+
+namespace ml
+{
+namespace model_store
+{
+
+/********************************************************************************
+ * @brief Enumeration class for the kind of model held by a record.
+ ********************************************************************************/
+enum class Kind : uint8_t
+{
+    LinReg = 1U,
+    LogReg = 2U,
+};
+
+/********************************************************************************
+ * @brief Model record as stored in EEPROM.
+ *
+ * @param version  Format version of the record.
+ * @param kind     The kind of model stored in the record.
+ * @param dataHash Hash of the training data the model was trained on.
+ * @param bias     The bias of the model.
+ * @param weight   The weight of the model.
+ * @param crc      CRC-16 of all preceding fields of the record.
+ ********************************************************************************/
+struct Record
+{
+    uint8_t version;
+    Kind kind;
+    uint32_t dataHash;
+    double bias;
+    double weight;
+    uint16_t crc;
+};
+
+/********************************************************************************
+ * @brief Training checkpoint as stored in EEPROM. Checkpoints are written to
+ *        two slots in turn, so the previous checkpoint survives if a write is
+ *        interrupted.
+ *
+ * @param version  Format version of the checkpoint.
+ * @param sequence Sequence number of the checkpoint, the latest is used.
+ * @param dataHash Hash of the training data of the model.
+ * @param state    The training state of the model.
+ * @param crc      CRC-16 of all preceding fields of the checkpoint.
+ ********************************************************************************/
+struct Checkpoint
+{
+    uint8_t version;
+    uint32_t sequence;
+    uint32_t dataHash;
+    LinReg::State state;
+    uint16_t crc;
+};
+
+constexpr uint8_t Version{1U};
+
+/** Format version of the checkpoints. */
+constexpr uint8_t CheckpointVersion{2U};
+
+/** EEPROM space used by the two checkpoint slots. */
+constexpr uint16_t CheckpointSize{2U * sizeof(Checkpoint)};
+
+/********************************************************************************
+ * @brief Calculates a hash (32-bit FNV-1a) of the values of specified dataset.
+ *
+ * @param data Reference to the dataset.
+ *
+ * @return The hash of the dataset.
+ ********************************************************************************/
+uint32_t hash(const Dataset& data);
+
+/********************************************************************************
+ * @brief Calculates the CRC-16 (CCITT) of specified bytes.
+ *
+ * @param data Pointer to the bytes.
+ * @param size The number of bytes.
+ *
+ * @return The CRC of the bytes.
+ ********************************************************************************/
+uint16_t crc16(const uint8_t* data, const uint16_t size);
+
+/********************************************************************************
+ * @brief Stores referenced record at specified EEPROM address. The version and
+ *        CRC of the record are set before it's stored.
+ *
+ * @param address The EEPROM address of the record.
+ * @param record  Reference to the record to store.
+ *
+ * @return True if the record was stored, else false.
+ ********************************************************************************/
+bool save(const uint16_t address, Record record);
+
+/********************************************************************************
+ * @brief Loads the record stored at specified EEPROM address.
+ *
+ * @param address The EEPROM address of the record.
+ * @param record  Reference to variable for storing the loaded record.
+ *
+ * @return True if a record with the current version and a valid CRC was
+ *         loaded, else false.
+ ********************************************************************************/
+bool load(const uint16_t address, Record& record);
+
+/********************************************************************************
+ * @brief Stores the coefficients of referenced model at specified EEPROM
+ *        address, together with the hash of its training data.
+ *
+ * @param address The EEPROM address of the record.
+ * @param model   Reference to the model to store.
+ *
+ * @return True if the model was stored, else false.
+ ********************************************************************************/
+bool save(const uint16_t address, const LinReg& model);
+
+/********************************************************************************
+ * @brief Restores the coefficients of referenced model from the record stored
+ *        at specified EEPROM address. The record is only used if it holds a
+ *        model of the same kind trained on the same training data.
+ *
+ * @param address The EEPROM address of the record.
+ * @param model   Reference to the model to restore.
+ *
+ * @return True if the model was restored, false if the record is missing,
+ *         corrupt or stale, in which case the model is left unchanged.
+ ********************************************************************************/
+bool load(const uint16_t address, LinReg& model);
+
+/********************************************************************************
+ * @brief Stores the coefficients of referenced logistic regression model at
+ *        specified EEPROM address, together with the hash of its training data.
+ *
+ * @param address The EEPROM address of the record.
+ * @param model   Reference to the model to store.
+ *
+ * @return True if the model was stored, else false.
+ ********************************************************************************/
+bool save(const uint16_t address, const LogReg& model);
+
+/********************************************************************************
+ * @brief Restores the coefficients of referenced logistic regression model
+ *        from the record stored at specified EEPROM address. The record is only
+ *        used if it holds a model of the same kind trained on the same
+ *        training data.
+ *
+ * @param address The EEPROM address of the record.
+ * @param model   Reference to the model to restore.
+ *
+ * @return True if the model was restored, false if the record is missing,
+ *         corrupt or stale, in which case the model is left unchanged.
+ ********************************************************************************/
+bool load(const uint16_t address, LogReg& model);
+
+/********************************************************************************
+ * @brief Resumes training of referenced model from the latest valid checkpoint
+ *        stored at specified EEPROM address.
+ *
+ * @param address The EEPROM address of the checkpoint slots.
+ * @param model   Reference to the model to resume.
+ *
+ * @return True if the model was resumed, false if no valid checkpoint for the
+ *         training data of the model was found, in which case the model is
+ *         left unchanged.
+ ********************************************************************************/
+bool loadCheckpoint(const uint16_t address, LinReg& model);
+
+/********************************************************************************
+ * @brief Class for writing training checkpoints in the background. A snapshot
+ *        of the training state is taken at a configurable interval, and is
+ *        then written one byte per call as the EEPROM becomes ready, so
+ *        training is never stalled by the (3.3 ms per byte) EEPROM writes.
+ ********************************************************************************/
+class CheckpointWriter
+{
+public:
+
+    /********************************************************************************
+     * @brief Creates new checkpoint writer.
+     *
+     * @param address  The EEPROM address of the checkpoint slots, which occupy
+     *                 CheckpointSize bytes.
+     * @param interval The number of training steps between checkpoints.
+     ********************************************************************************/
+    CheckpointWriter(const uint16_t address, const uint32_t interval);
+
+    /********************************************************************************
+     * @brief Continues writing the pending checkpoint, or takes a snapshot of
+     *        referenced model if the interval has elapsed. Never blocks, so
+     *        it should be called between training steps.
+     *
+     * @param model Reference to the model being trained.
+     *
+     * @return True if a checkpoint was completed by this call, else false.
+     ********************************************************************************/
+    bool update(const LinReg& model);
+
+    /********************************************************************************
+     * @brief Waits until the pending checkpoint, if any, is written.
+     ********************************************************************************/
+    void flush();
+
+    /********************************************************************************
+     * @brief Indicates if a checkpoint is being written.
+     *
+     * @return True if a checkpoint is being written, else false.
+     ********************************************************************************/
+    bool busy() const;
+
+private:
+    void snapshot(const LinReg& model);
+    uint16_t slotAddress() const;
+
+    Checkpoint myCheckpoint{};
+    uint32_t myInterval;
+    uint32_t myLastSteps{};
+    uint16_t myAddress;
+    uint8_t myIndex{sizeof(Checkpoint)};
+    uint8_t mySlot{};
+    bool myInitialized{};
+};
+
+} // namespace model_store
+} // namespace ml
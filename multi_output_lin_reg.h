@@ -0,0 +1,83 @@
+/********************************************************************************
+ * @brief Linear regression model with several outputs sharing one input.
+ ********************************************************************************/
+#pragma once
+
+#include "array.h"
+#include "statistics.h"
+
+namespace ml
+{
+
+/********************************************************************************
+ * @brief Class for linear regression models predicting several outputs from the
+ *        same input, e.g. several calibrated quantities from one ADC channel.
+ *        All outputs are fitted in a single pass over the shared input, and
+ *        the coefficients are stored contiguously as an Outputs x 2 matrix.
+ *
+ * @tparam Outputs The number of outputs.
+ *
+ * @note The number of outputs must exceed 0, else a compilation error will be
+ *       generated.
+ ********************************************************************************/
+template <size_t Outputs>
+class MultiOutputLinReg
+{
+public:
+
+    /********************************************************************************
+     * @brief Creates model predicting 0 for all outputs.
+     ********************************************************************************/
+    MultiOutputLinReg() = default;
+
+    /********************************************************************************
+     * @brief Fits all outputs with the closed-form least squares solution. The
+     *        input values are read once, and the statistics of the input are
+     *        shared by all outputs.
+     *
+     * @param input   Pointer to the input values.
+     * @param outputs Pointer to the output columns, one per output, each
+     *                holding count values.
+     * @param count   The number of samples.
+     *
+     * @return True if the model was fitted, false if the input values don't
+     *         vary (or no samples were given), in which case each bias is set
+     *         to the mean of its output and each weight to 0.
+     ********************************************************************************/
+    bool fit(const double* input, const double* const* outputs, const uint32_t count);
+
+    /********************************************************************************
+     * @brief Provides the coefficients of specified output.
+     *
+     * @param output The index of the output.
+     *
+     * @return Reference to the coefficients of the output.
+     ********************************************************************************/
+    const Coefficients& coefficients(const size_t output) const;
+
+    /********************************************************************************
+     * @brief Predicts specified output for given input.
+     *
+     * @param output The index of the output.
+     * @param input  Input value for prediction.
+     *
+     * @return Predicted output value, or 0 if the output index is invalid.
+     ********************************************************************************/
+    double predict(const size_t output, const double input) const;
+
+    /********************************************************************************
+     * @brief Predicts all outputs for given input at once.
+     *
+     * @param input   Input value for prediction.
+     * @param outputs Reference to array for storing the predicted values.
+     ********************************************************************************/
+    void predict(const double input, container::Array<double, Outputs>& outputs) const;
+
+private:
+    static_assert(Outputs > 0U, "Model must have at least one output!");
+    container::Array<Coefficients, Outputs> myCoefficients{};
+};
+
+} // namespace ml
+
+#include "multi_output_lin_reg_impl.h"
@@ -0,0 +1,74 @@
+/********************************************************************************
+ * @brief Implementation details of the ml::MultiOutputLinReg class.
+ *
+ * @note Don't include this header, use <multi_output_lin_reg.h> instead!
+ ********************************************************************************/
+#pragma once
+
+namespace ml
+{
+
+// -----------------------------------------------------------------------------
+template <size_t Outputs>
+bool MultiOutputLinReg<Outputs>::fit(const double* input, const double* const* outputs,
+                                     const uint32_t count)
+{
+    // Welford's method, with the mean and spread of the input shared by all
+    // outputs. The coefficient matrix holds the running means and co-moments
+    // until the fit is solved.
+    double meanInput{};
+    double sumSquaresInput{};
+
+    for (size_t k{}; k < Outputs; ++k) { myCoefficients[k] = Coefficients{}; }
+
+    for (uint32_t i{}; i < count; ++i)
+    {
+        const double deltaInput{input[i] - meanInput};
+        meanInput += deltaInput / (i + 1U);
+        sumSquaresInput += deltaInput * (input[i] - meanInput);
+
+        for (size_t k{}; k < Outputs; ++k)
+        {
+            auto& moments{myCoefficients[k]};
+            moments.bias += (outputs[k][i] - moments.bias) / (i + 1U);
+            moments.weight += deltaInput * (outputs[k][i] - moments.bias);
+        }
+    }
+
+    const bool solvable{sumSquaresInput > 0.0};
+    for (size_t k{}; k < Outputs; ++k)
+    {
+        auto& coefficients{myCoefficients[k]};
+        coefficients.weight = solvable ? coefficients.weight / sumSquaresInput : 0.0;
+        coefficients.bias -= coefficients.weight * meanInput;
+    }
+    return solvable;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t Outputs>
+const Coefficients& MultiOutputLinReg<Outputs>::coefficients(const size_t output) const
+{
+    return myCoefficients[output];
+}
+
+// -----------------------------------------------------------------------------
+template <size_t Outputs>
+double MultiOutputLinReg<Outputs>::predict(const size_t output, const double input) const
+{
+    if (output >= Outputs) { return 0.0; }
+    return myCoefficients[output].bias + myCoefficients[output].weight * input;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t Outputs>
+void MultiOutputLinReg<Outputs>::predict(const double input,
+                                         container::Array<double, Outputs>& outputs) const
+{
+    for (size_t k{}; k < Outputs; ++k)
+    {
+        outputs[k] = myCoefficients[k].bias + myCoefficients[k].weight * input;
+    }
+}
+
+} // namespace ml
@@ -0,0 +1,94 @@
+/********************************************************************************
+ * @brief Piecewise linear (segmented) regression model for calibration curves
+ *        that aren't well described by a single line.
+ ********************************************************************************/
+#pragma once
+
+#include "array.h"
+#include "dataset.h"
+#include "statistics.h"
+#include "vector.h"
+
+namespace ml
+{
+
+/********************************************************************************
+ * @brief Class for piecewise linear regression models. The input range is split
+ *        into up to Segments segments at breakpoints chosen to minimize the
+ *        total squared error, and each segment is fitted with its own line.
+ *
+ * @tparam Segments The maximum number of segments.
+ *
+ * @note The number of segments must exceed 0, else a compilation error will be
+ *       generated.
+ ********************************************************************************/
+template <size_t Segments>
+class PiecewiseLinReg
+{
+public:
+
+    /********************************************************************************
+     * @brief Creates model with one segment predicting 0 for all inputs.
+     ********************************************************************************/
+    PiecewiseLinReg() = default;
+
+    /********************************************************************************
+     * @brief Fits the model to referenced training data via dynamic programming
+     *        over the optimal segmentation. Each segment holds at least two
+     *        samples, so fewer segments are used for small datasets.
+     *
+     * @param data Reference to the training data, sorted by input value.
+     *
+     * @return True if the model was fitted, false if the data holds fewer than
+     *         two samples, isn't sorted or the fit ran out of memory.
+     ********************************************************************************/
+    bool fit(const Dataset& data);
+
+    /********************************************************************************
+     * @brief Predicts the output for specified input. The segment is found by a
+     *        binary search with a fixed number of steps, so the cost of a
+     *        prediction doesn't depend on the input.
+     *
+     * @param input Input value for prediction.
+     *
+     * @return Predicted output value.
+     ********************************************************************************/
+    double predict(const double input) const;
+
+    /********************************************************************************
+     * @brief Provides the number of fitted segments.
+     *
+     * @return The number of segments.
+     ********************************************************************************/
+    size_t segmentCount() const;
+
+    /********************************************************************************
+     * @brief Provides the coefficients of specified segment.
+     *
+     * @param index Index of the segment.
+     *
+     * @return Reference to the coefficients of the segment.
+     ********************************************************************************/
+    const Coefficients& segment(const size_t index) const;
+
+    /********************************************************************************
+     * @brief Provides the smallest input value of specified segment.
+     *
+     * @param index Index of the segment.
+     *
+     * @return The breakpoint at which the segment starts.
+     ********************************************************************************/
+    double breakpoint(const size_t index) const;
+
+private:
+    static_assert(Segments > 0U, "Piecewise model must have at least one segment!");
+    size_t findSegment(const double input) const;
+
+    container::Array<double, Segments> myBreakpoints{};
+    container::Array<Coefficients, Segments> mySegments{};
+    size_t mySegmentCount{1U};
+};
+
+} // namespace ml
+
+#include "piecewise_lin_reg_impl.h"
@@ -0,0 +1,129 @@
+/********************************************************************************
+ * @brief Implementation details of the ml::PiecewiseLinReg class.
+ *
+ * @note Don't include this header, use <piecewise_lin_reg.h> instead!
+ ********************************************************************************/
+#pragma once
+
+namespace ml
+{
+namespace detail
+{
+
+// -----------------------------------------------------------------------------
+constexpr size_t highestPowerOfTwo(const size_t value, const size_t power = 1U)
+{
+    return power * 2U > value ? power : highestPowerOfTwo(value, power * 2U);
+}
+
+// -----------------------------------------------------------------------------
+inline bool isSorted(const Dataset& data)
+{
+    for (uint32_t i{1U}; i < data.count(); ++i)
+    {
+        if (data.input()[i] < data.input()[i - 1U]) { return false; }
+    }
+    return true;
+}
+
+} // namespace detail
+
+// -----------------------------------------------------------------------------
+template <size_t Segments>
+bool PiecewiseLinReg<Segments>::fit(const Dataset& data)
+{
+    const uint32_t count{data.count()};
+    if (count < 2U || !detail::isSorted(data)) { return false; }
+
+    const size_t segments{count / 2U < Segments ? count / 2U : Segments};
+    const size_t columns{count + 1U};
+    container::Vector<double> cost{};
+    container::Vector<uint32_t> start{};
+    if (!cost.resize(segments * columns) || !start.resize(segments * columns))
+    {
+        return false;
+    }
+
+    // cost[k * columns + j] holds the smallest total error of splitting the
+    // first j samples into k + 1 segments, or -1 if that isn't possible.
+    for (size_t k{}; k < segments; ++k)
+    {
+        for (uint32_t j{}; j < columns; ++j)
+        {
+            double best{-1.0};
+            Statistics statistics{};
+            const uint32_t firstStart{j >= 2U * (k + 1U) ? 2U * k : j};
+
+            for (uint32_t i{j}; i-- > firstStart;)
+            {
+                statistics.add(data.input()[i], data.output()[i]);
+                if (j - i < 2U) { continue; }
+                const double previous{k == 0U ? (i == 0U ? 0.0 : -1.0) :
+                                      cost[(k - 1U) * columns + i]};
+                if (previous < 0.0) { continue; }
+                const double total{previous + statistics.residual()};
+
+                if (best < 0.0 || total < best)
+                {
+                    best = total;
+                    start[k * columns + j] = i;
+                }
+            }
+            cost[k * columns + j] = best;
+        }
+    }
+
+    uint32_t end{count};
+    for (size_t k{segments}; k-- > 0U;)
+    {
+        const uint32_t first{start[k * columns + end]};
+        Statistics statistics{};
+        statistics.add(data.input() + first, data.output() + first, end - first);
+        statistics.solve(mySegments[k].bias, mySegments[k].weight);
+        myBreakpoints[k] = data.input()[first];
+        end = first;
+    }
+    mySegmentCount = segments;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t Segments>
+double PiecewiseLinReg<Segments>::predict(const double input) const
+{
+    const auto& coefficients{mySegments[findSegment(input)]};
+    return coefficients.bias + coefficients.weight * input;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t Segments>
+size_t PiecewiseLinReg<Segments>::segmentCount() const { return mySegmentCount; }
+
+// -----------------------------------------------------------------------------
+template <size_t Segments>
+const Coefficients& PiecewiseLinReg<Segments>::segment(const size_t index) const
+{
+    return mySegments[index];
+}
+
+// -----------------------------------------------------------------------------
+template <size_t Segments>
+double PiecewiseLinReg<Segments>::breakpoint(const size_t index) const
+{
+    return myBreakpoints[index];
+}
+
+// -----------------------------------------------------------------------------
+template <size_t Segments>
+size_t PiecewiseLinReg<Segments>::findSegment(const double input) const
+{
+    size_t segment{};
+    for (size_t step{detail::highestPowerOfTwo(Segments)}; step > 0U; step >>= 1U)
+    {
+        const size_t next{segment + step};
+        if (next < mySegmentCount && myBreakpoints[next] <= input) { segment = next; }
+    }
+    return segment;
+}
+
+} // namespace ml
@@ -0,0 +1,75 @@
+/********************************************************************************
+ * @brief Implementation details of the fixed-point linear regression model.
+ ********************************************************************************/
+#include "quantized_lin_reg.h"
+
+namespace ml
+{
+namespace
+{
+
+constexpr uint8_t MaxShift{30U};
+constexpr double Int32Max{2147483647.0};
+
+// -----------------------------------------------------------------------------
+double absolute(const double value) { return value < 0.0 ? -value : value; }
+
+// -----------------------------------------------------------------------------
+int32_t roundToInt(const double value)
+{
+    return static_cast<int32_t>(value >= 0.0 ? value + 0.5 : value - 0.5);
+}
+
+} // namespace
+
+// -----------------------------------------------------------------------------
+bool QuantizedLinReg::quantize(const LinReg& model, const Scaling& scaling,
+                               QuantizedLinReg& quantized)
+{
+    if (scaling.shift == 0U || scaling.shift > MaxShift) { return false; }
+    const double one{static_cast<double>(1UL << scaling.shift)};
+    const double bias{model.getBias() * scaling.outputScale};
+    const double weight{model.getWeight() * scaling.inputPerCode * scaling.outputScale};
+
+    if (absolute(bias * one) + absolute(weight * one) * scaling.maxCode + one >= Int32Max)
+    {
+        return false;
+    }
+
+    QuantizedLinReg result{};
+    result.myBias = roundToInt(bias * one);
+    result.myWeight = roundToInt(weight * one);
+    result.myRounding = static_cast<int32_t>(1UL << (scaling.shift - 1U));
+    result.myShift = scaling.shift;
+
+    // The quantization error is linear in the code, hence largest at either end
+    // of the code range. Rounding the result adds at most half an output unit.
+    const double errorMin{absolute(result.myBias / one - bias)};
+    const double errorMax{absolute((result.myBias + static_cast<double>(result.myWeight) *
+        scaling.maxCode) / one - (bias + weight * scaling.maxCode))};
+    result.myErrorBound = (errorMin > errorMax ? errorMin : errorMax) + 0.5;
+
+    if (result.myErrorBound > scaling.maxError) { return false; }
+    quantized = result;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+int32_t QuantizedLinReg::predict(const uint16_t code) const
+{
+    return (myBias + myWeight * static_cast<int32_t>(code) + myRounding) >> myShift;
+}
+
+// -----------------------------------------------------------------------------
+double QuantizedLinReg::errorBound() const { return myErrorBound; }
+
+// -----------------------------------------------------------------------------
+int32_t QuantizedLinReg::bias() const { return myBias; }
+
+// -----------------------------------------------------------------------------
+int32_t QuantizedLinReg::weight() const { return myWeight; }
+
+// -----------------------------------------------------------------------------
+uint8_t QuantizedLinReg::shift() const { return myShift; }
+
+} // namespace ml
@@ -0,0 +1,133 @@
+/********************************************************************************
+ * @brief Fixed-point linear regression model for integer-only inference on
+ *        raw ADC codes.
+ ********************************************************************************/
+#pragma once
+
+#include <stdint.h>
+
+#include "LinReg.h"
+
+namespace ml
+{
+
+/********************************************************************************
+ * @brief Class for linear regression models quantized to fixed-point integers.
+ *        The model maps a raw ADC code straight to a scaled output, such as
+ *        tenths of a degree, using one integer multiply, one add and a shift:
+ *
+ *        output = (bias + weight * code + rounding) >> shift
+ ********************************************************************************/
+class QuantizedLinReg
+{
+public:
+
+    /********************************************************************************
+     * @brief Parameters for quantizing a floating-point model.
+     *
+     * @param inputPerCode The model input corresponding to one ADC code, for
+     *                     instance Vcc / 1023 for a model trained on volts.
+     * @param outputScale  The factor the model output is scaled by, for instance
+     *                     10 to predict tenths of a degree.
+     * @param maxCode      The largest ADC code to predict for.
+     * @param shift        The number of fractional bits of the coefficients.
+     * @param maxError     The largest permitted difference to the floating-point
+     *                     model over all codes, in scaled output units.
+     ********************************************************************************/
+    struct Scaling
+    {
+        double inputPerCode;
+        double outputScale;
+        uint16_t maxCode;
+        uint8_t shift;
+        double maxError;
+    };
+
+    /********************************************************************************
+     * @brief Creates quantized model predicting 0 for all codes.
+     ********************************************************************************/
+    QuantizedLinReg() = default;
+
+    /********************************************************************************
+     * @brief Creates quantized model from fixed-point coefficients, e.g. ones
+     *        exported by model_export, so the model can be baked into the
+     *        firmware as a compile-time constant.
+     *
+     * @param bias       The fixed-point bias.
+     * @param weight     The fixed-point weight.
+     * @param shift      The number of fractional bits of the coefficients.
+     * @param errorBound The error bound of the model in scaled output units.
+     ********************************************************************************/
+    constexpr QuantizedLinReg(const int32_t bias, const int32_t weight,
+                              const uint8_t shift, const double errorBound)
+        : myBias{bias}
+        , myWeight{weight}
+        , myRounding{shift > 0U ? static_cast<int32_t>(1UL << (shift - 1U)) : 0}
+        , myShift{shift}
+        , myErrorBound{errorBound}
+    {
+    }
+
+    /********************************************************************************
+     * @brief Quantizes referenced floating-point model. The error bound is
+     *        validated over the full code range before the model is accepted.
+     *
+     * @param model     Reference to the floating-point model.
+     * @param scaling   Reference to the quantization parameters.
+     * @param quantized Reference to the quantized model to set.
+     *
+     * @return True if the model was quantized, false if the scaled coefficients
+     *         overflow or the error bound is exceeded, in which case the
+     *         quantized model is left unchanged.
+     ********************************************************************************/
+    static bool quantize(const LinReg& model, const Scaling& scaling,
+                         QuantizedLinReg& quantized);
+
+    /********************************************************************************
+     * @brief Predicts the scaled output for specified ADC code using integer
+     *        arithmetic only.
+     *
+     * @param code The raw ADC code.
+     *
+     * @return The predicted output in scaled units, rounded to nearest.
+     ********************************************************************************/
+    int32_t predict(const uint16_t code) const;
+
+    /********************************************************************************
+     * @brief Provides the largest difference to the floating-point model over
+     *        the code range the model was quantized for.
+     *
+     * @return The error bound in scaled output units.
+     ********************************************************************************/
+    double errorBound() const;
+
+    /********************************************************************************
+     * @brief Provides the fixed-point bias.
+     *
+     * @return The bias with shift fractional bits.
+     ********************************************************************************/
+    int32_t bias() const;
+
+    /********************************************************************************
+     * @brief Provides the fixed-point weight.
+     *
+     * @return The weight with shift fractional bits.
+     ********************************************************************************/
+    int32_t weight() const;
+
+    /********************************************************************************
+     * @brief Provides the number of fractional bits of the coefficients.
+     *
+     * @return The number of fractional bits.
+     ********************************************************************************/
+    uint8_t shift() const;
+
+private:
+    int32_t myBias{};
+    int32_t myWeight{};
+    int32_t myRounding{};
+    uint8_t myShift{};
+    double myErrorBound{};
+};
+
+} // namespace ml
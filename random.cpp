@@ -0,0 +1,47 @@
+/********************************************************************************
+ * @brief Implementation details of the pseudo-random number generator.
+ ********************************************************************************/
+#include "random.h"
+
+namespace ml
+{
+namespace
+{
+
+// -----------------------------------------------------------------------------
+uint32_t mix(uint32_t value)
+{
+    // Spreads the seed bits (murmur3 finalizer), so that consecutive seeds,
+    // e.g. one per task, give independent sequences.
+    value ^= value >> 16U;
+    value *= 0x85EBCA6BUL;
+    value ^= value >> 13U;
+    value *= 0xC2B2AE35UL;
+    value ^= value >> 16U;
+    return value != 0U ? value : 1U;
+}
+
+} // namespace
+
+// -----------------------------------------------------------------------------
+Random::Random(const uint32_t seed)
+    : myState{mix(seed)}
+{
+}
+
+// -----------------------------------------------------------------------------
+uint32_t Random::next()
+{
+    myState ^= myState << 13U;
+    myState ^= myState >> 17U;
+    myState ^= myState << 5U;
+    return myState;
+}
+
+// -----------------------------------------------------------------------------
+uint32_t Random::next(const uint32_t bound)
+{
+    return bound > 0U ? next() % bound : 0U;
+}
+
+} // namespace ml
@@ -0,0 +1,48 @@
+/********************************************************************************
+ * @brief Small, seedable pseudo-random number generator.
+ ********************************************************************************/
+#pragma once
+
+#include <stdint.h>
+
+namespace ml
+{
+
+/********************************************************************************
+ * @brief Class for generating pseudo-random numbers with the 32-bit xorshift
+ *        algorithm. The state is a single word, so a generator is cheap to
+ *        create per task, and every seed gives a reproducible sequence.
+ ********************************************************************************/
+class Random
+{
+public:
+
+    /********************************************************************************
+     * @brief Creates new generator.
+     *
+     * @param seed The seed of the generator. Seeds close to each other still
+     *             give unrelated sequences (default = 1).
+     ********************************************************************************/
+    explicit Random(const uint32_t seed = 1U);
+
+    /********************************************************************************
+     * @brief Provides the next number of the sequence.
+     *
+     * @return A pseudo-random number in the range 1 - 2^32 - 1.
+     ********************************************************************************/
+    uint32_t next();
+
+    /********************************************************************************
+     * @brief Provides the next number of the sequence limited to specified range.
+     *
+     * @param bound The upper limit of the range (exclusive), must exceed 0.
+     *
+     * @return A pseudo-random number in the range 0 - bound - 1.
+     ********************************************************************************/
+    uint32_t next(const uint32_t bound);
+
+private:
+    uint32_t myState;
+};
+
+} // namespace ml
@@ -0,0 +1,72 @@
+/********************************************************************************
+ * @brief Implementation details of the recursive least squares estimator.
+ ********************************************************************************/
+#include "recursive_least_squares.h"
+
+namespace ml
+{
+
+// -----------------------------------------------------------------------------
+RecursiveLeastSquares::RecursiveLeastSquares(const double forgettingFactor,
+                                             const double maxTrace)
+    : myForgettingFactor{forgettingFactor > 0.0 && forgettingFactor <= 1.0 ? forgettingFactor : 1.0}
+    , myMaxTrace{maxTrace > 0.0 ? maxTrace : 10000.0}
+{
+    reset(0.0, 0.0);
+}
+
+// -----------------------------------------------------------------------------
+void RecursiveLeastSquares::reset(const double bias, const double weight,
+                                  const double covariance)
+{
+    myBias = bias;
+    myWeight = weight;
+    myCovarianceBias = covariance;
+    myCovarianceCross = 0.0;
+    myCovarianceWeight = covariance;
+}
+
+// -----------------------------------------------------------------------------
+double RecursiveLeastSquares::update(const double input, const double output)
+{
+    // With the regressor [1, x], the covariance product P * [1, x] and the
+    // gain reduce to a handful of scalar operations.
+    const double productBias{myCovarianceBias + myCovarianceCross * input};
+    const double productWeight{myCovarianceCross + myCovarianceWeight * input};
+    const double denominator{myForgettingFactor + productBias + productWeight * input};
+    const double gainBias{productBias / denominator};
+    const double gainWeight{productWeight / denominator};
+    const double residual{output - predict(input)};
+
+    myBias += gainBias * residual;
+    myWeight += gainWeight * residual;
+    myCovarianceBias = (myCovarianceBias - gainBias * productBias) / myForgettingFactor;
+    myCovarianceCross = (myCovarianceCross - gainBias * productWeight) / myForgettingFactor;
+    myCovarianceWeight = (myCovarianceWeight - gainWeight * productWeight) / myForgettingFactor;
+
+    // Scaling the covariance keeps it positive definite, while it prevents
+    // wind-up in directions the readings don't excite.
+    const double trace{myCovarianceBias + myCovarianceWeight};
+    if (trace > myMaxTrace)
+    {
+        const double scale{myMaxTrace / trace};
+        myCovarianceBias *= scale;
+        myCovarianceCross *= scale;
+        myCovarianceWeight *= scale;
+    }
+    return residual;
+}
+
+// -----------------------------------------------------------------------------
+double RecursiveLeastSquares::getBias() const { return myBias; }
+
+// -----------------------------------------------------------------------------
+double RecursiveLeastSquares::getWeight() const { return myWeight; }
+
+// -----------------------------------------------------------------------------
+double RecursiveLeastSquares::predict(const double input) const
+{
+    return myBias + myWeight * input;
+}
+
+} // namespace ml
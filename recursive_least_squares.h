@@ -0,0 +1,92 @@
+/********************************************************************************
+ * @brief Recursive least squares estimator for recalibrating linear regression
+ *        models one reference reading at a time.
+ ********************************************************************************/
+#pragma once
+
+#include <stdint.h>
+
+namespace ml
+{
+
+/********************************************************************************
+ * @brief Class for recursive least squares (RLS) estimation of the coefficients
+ *        of a linear regression model y = bias + weight * x. Each reference
+ *        reading updates the coefficients in constant time and memory, and a
+ *        forgetting factor below 1 lets the model follow slow drift without
+ *        retraining on a full training set. With a forgetting factor below 1,
+ *        readings that don't excite both coefficients (e.g. a constant input)
+ *        make the covariance grow without bound, hence its trace is capped.
+ ********************************************************************************/
+class RecursiveLeastSquares
+{
+public:
+
+    /********************************************************************************
+     * @brief Creates new estimator.
+     *
+     * @param forgettingFactor The weight of past readings, in the range (0, 1]
+     *                         (default = 0.98).
+     * @param maxTrace         The maximum trace of the covariance. The
+     *                         covariance is scaled down whenever an update
+     *                         exceeds it (default = 10000).
+     ********************************************************************************/
+    explicit RecursiveLeastSquares(const double forgettingFactor = 0.98,
+                                   const double maxTrace = 10000.0);
+
+    /********************************************************************************
+     * @brief Restarts the estimation from specified coefficients, e.g. the ones
+     *        of the model to recalibrate.
+     *
+     * @param bias       The initial bias.
+     * @param weight     The initial weight.
+     * @param covariance The initial uncertainty of the coefficients. A large
+     *                   value lets the first readings dominate (default = 1000).
+     ********************************************************************************/
+    void reset(const double bias, const double weight, const double covariance = 1000.0);
+
+    /********************************************************************************
+     * @brief Updates the coefficients with a reference reading.
+     *
+     * @param input  The input value of the reading.
+     * @param output The reference output value of the reading.
+     *
+     * @return The residual (reference - prediction) before the update.
+     ********************************************************************************/
+    double update(const double input, const double output);
+
+    /********************************************************************************
+     * @brief Provides the estimated bias.
+     *
+     * @return The bias as a double.
+     ********************************************************************************/
+    double getBias() const;
+
+    /********************************************************************************
+     * @brief Provides the estimated weight.
+     *
+     * @return The weight as a double.
+     ********************************************************************************/
+    double getWeight() const;
+
+    /********************************************************************************
+     * @brief Predicts the output for specified input with the estimated
+     *        coefficients.
+     *
+     * @param input Input value for prediction.
+     *
+     * @return Predicted output value.
+     ********************************************************************************/
+    double predict(const double input) const;
+
+private:
+    double myBias{};
+    double myWeight{};
+    double myCovarianceBias{};
+    double myCovarianceCross{};
+    double myCovarianceWeight{};
+    double myForgettingFactor;
+    double myMaxTrace;
+};
+
+} // namespace ml
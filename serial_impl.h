@@ -72,11 +72,11 @@ bool printf(const char* format, const Args&... args)
     if (format == nullptr) { return false; }
     if (sizeof...(args) > 0)
     {
-        const int length{snprintf(nullptr, 0, format, nullptr)};
-        char* buffer{(char*)malloc(sizeof(char) * length)};
+        const int length{snprintf(nullptr, 0, format, args...)};
+        if (length < 0) { return false; }
+        char* buffer{(char*)malloc(sizeof(char) * (length + 1))};
         if (!buffer) { return false; }
-        buffer[0U] = '\0';
-        sprintf(buffer, format, args...);
+        snprintf(buffer, length + 1, format, args...);
         detail::print(buffer);
         free(buffer);
     }
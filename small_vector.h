@@ -0,0 +1,337 @@
+/********************************************************************************
+ * @brief Implementation of dynamic vectors with inline storage for small sizes.
+ ********************************************************************************/
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "vector.h"
+
+namespace container
+{
+/********************************************************************************
+ * @brief Class for implementation of small-buffer-optimized vectors. Up to N
+ *        elements are stored inline in the vector itself, so small vectors
+ *        cost no heap allocation and no malloc overhead. Beyond N elements the
+ *        content spills to the heap and the vector grows like a Vector. The
+ *        interface is the same as for Vector.
+ *
+ * @tparam T The data type of the vector.
+ * @tparam N The number of elements stored inline.
+ ********************************************************************************/
+template <typename T, size_t N>
+class SmallVector
+{
+    static_assert(N > 0U, "The inline capacity must be at least one element!");
+
+public:
+    using Iterator = typename Vector<T>::Iterator;
+    using ConstIterator = typename Vector<T>::ConstIterator;
+
+    /********************************************************************************
+     * @brief Creates empty vector.
+     ********************************************************************************/
+    SmallVector();
+
+    /********************************************************************************
+     * @brief Creates vector of specified size.
+     *
+     * @param size The size of the vector, i.e. the number of elements it can hold.
+     ********************************************************************************/
+    SmallVector(const size_t size);
+
+    /********************************************************************************
+     * @brief Creates vector containing specified values.
+     *
+     * @tparam Values Parameter pack containing values.
+     *
+     * @param values The values to add to the vector.
+     ********************************************************************************/
+    template <typename... Values>
+    SmallVector(const Values&&... values);
+
+    /********************************************************************************
+     * @brief Creates vector as a copy of referenced source.
+     *
+     * @param source Reference to vector whose content is copied to the new vector.
+     ********************************************************************************/
+    SmallVector(const SmallVector<T, N>& source);
+
+    /********************************************************************************
+     * @brief Moves the content of referenced source to the new vector. Heap
+     *        memory is handed over, while inline elements are moved one by one.
+     *        The source vector is emptied after the move operation is performed.
+     *
+     * @param source Reference to vector whose content is moved to the new vector.
+     ********************************************************************************/
+    SmallVector(SmallVector<T, N>&& source) noexcept;
+
+    /********************************************************************************
+     * @brief Destroys the elements and releases heap memory before deletion.
+     ********************************************************************************/
+    ~SmallVector();
+
+    /********************************************************************************
+     * @brief Returns reference to the element at specified index in the vector.
+     *
+     * @param index Index of the requested element.
+     *
+     * @return A reference to the element at specified index.
+     ********************************************************************************/
+    T& operator[](const size_t index);
+
+    /********************************************************************************
+     * @brief Returns reference to the element at specified index in the vector.
+     *
+     * @param index Index of the requested element.
+     *
+     * @return A reference to the element at specified index.
+     ********************************************************************************/
+    const T& operator[](const size_t index) const;
+
+    /********************************************************************************
+     * @brief Assigns specified values to the vector. Previous values are cleared
+     *        before copying.
+     *
+     * @tparam Values Parameter pack holding values.
+     *
+     * @param values Reference to the values to add.
+     ********************************************************************************/
+    template <typename... Values>
+    void operator=(const Values&&... values);
+
+    /********************************************************************************
+     * @brief Copies the content of referenced source to assigned vector. Previous
+     *        values are cleared before copying.
+     *
+     * @param source Reference to vector containing the the values to add.
+     ********************************************************************************/
+    void operator=(const SmallVector<T, N>& source);
+
+    /********************************************************************************
+     * @brief Moves the content of referenced source to assigned vector. Previous
+     *        values are cleared and the source vector is emptied.
+     *
+     * @param source Reference to vector whose content is moved to assigned vector.
+     ********************************************************************************/
+    void operator=(SmallVector<T, N>&& source) noexcept;
+
+    /********************************************************************************
+     * @brief Pushes referenced values to the back of the vector.
+     *
+     * @tparam NumValues The number of values to add.
+     *
+     * @param values Reference to the values to add.
+     ********************************************************************************/
+    template <size_t NumValues>
+    void operator+=(const T (&values)[NumValues]);
+
+    /********************************************************************************
+     * @brief Adds values from the vector to the back of assigned vector.
+     *
+     * @param source Reference to vector containing the the values to add.
+     ********************************************************************************/
+    void operator+=(const SmallVector<T, N>& source);
+
+    /********************************************************************************
+     * @brief Provides the data held by the vector.
+     *
+     * @return Pointer to the start address of the vector.
+     ********************************************************************************/
+    const T* data() const;
+
+    /********************************************************************************
+     * @brief Returns the size of the vector in the number of elements it holds.
+     *
+     * @return The size of the vector as an unsigned integer.
+     ********************************************************************************/
+    size_t size() const;
+
+    /********************************************************************************
+     * @brief Returns the capacity of the vector, i.e. the number of elements it
+     *        can hold before it must be reallocated. The capacity is never below
+     *        the inline capacity N.
+     *
+     * @return The capacity of the vector as an unsigned integer.
+     ********************************************************************************/
+    size_t capacity() const;
+
+    /********************************************************************************
+     * @brief Indicates if the vector is empty.
+     *
+     * @return True if the vector vector is empty, else false.
+     ********************************************************************************/
+    bool empty() const;
+
+    /********************************************************************************
+     * @brief Indicates if the elements are stored inline, i.e. if the vector
+     *        occupies no heap memory.
+     *
+     * @return True if the elements are stored inline, else false.
+     ********************************************************************************/
+    bool isInline() const;
+
+    /********************************************************************************
+     * @brief Provides the start address of the vector.
+     *
+     * @return Iterator pointing at the start address of the the vector.
+     ********************************************************************************/
+    Iterator begin();
+
+    /********************************************************************************
+     * @brief Provides the start address of the vector.
+     *
+     * @return Iterator pointing at the start address of the the vector.
+     ********************************************************************************/
+    ConstIterator begin() const;
+
+    /********************************************************************************
+     * @brief Provides the end address of the vector.
+     *
+     * @return Iterator pointing at the end address of the the vector.
+     ********************************************************************************/
+    Iterator end();
+
+    /********************************************************************************
+     * @brief Provides the end address of the vector.
+     *
+     * @return Iterator pointing at the end address of the the vector.
+     ********************************************************************************/
+    ConstIterator end() const;
+
+    /********************************************************************************
+     * @brief Provides the reverse start address of the the vector.
+     *
+     * @return Iterator pointing at the reverse start address of the the vector.
+     ********************************************************************************/
+    Iterator rbegin();
+
+    /********************************************************************************
+     * @brief Provides the reverse start address of the the vector.
+     *
+     * @return Iterator pointing at the reverse start address of the the vector.
+     ********************************************************************************/
+    ConstIterator rbegin() const;
+
+    /********************************************************************************
+     * @brief Provides the reverse end address of the the vector.
+     *
+     * @return Iterator pointing at the reverse end address of the the vector.
+     ********************************************************************************/
+    Iterator rend();
+
+    /********************************************************************************
+     * @brief Provides the reverse end address of the the vector.
+     *
+     * @return Iterator pointing at the reverse end address of the the vector.
+     ********************************************************************************/
+    ConstIterator rend() const;
+
+    /********************************************************************************
+     * @brief Returns the address of the last element of the vector.
+     *
+     * @return Pointer to the last element of the vector.
+     ********************************************************************************/
+    T* last();
+
+    /********************************************************************************
+     * @brief Returns the address of the last element of the vector.
+     *
+     * @return Pointer to the last element of the vector.
+     ********************************************************************************/
+    const T* last() const;
+
+    /********************************************************************************
+     * @brief Clears content of the vector. Heap memory is released and the
+     *        vector returns to its inline storage.
+     ********************************************************************************/
+    void clear();
+
+    /********************************************************************************
+     * @brief Resizes the vector to specified new size. The vector is only
+     *        reallocated if the new size exceeds the capacity.
+     *
+     * @param newSize The new size of the vector.
+     *
+     * @return True if the vector was resized, else false.
+     ********************************************************************************/
+    bool resize(const size_t newSize);
+
+    /********************************************************************************
+     * @brief Reserves memory for at least specified number of elements, so that
+     *        the vector can grow to that size without being reallocated.
+     *
+     * @param newCapacity The requested capacity of the vector.
+     *
+     * @return True if the memory was reserved, else false.
+     ********************************************************************************/
+    bool reserve(const size_t newCapacity);
+
+    /********************************************************************************
+     * @brief Releases unused capacity. If the elements fit inline, they are
+     *        moved back into the inline storage and the heap memory is released.
+     *
+     * @return True if the unused capacity was released, else false.
+     ********************************************************************************/
+    bool shrinkToFit();
+
+    /********************************************************************************
+     * @brief Pushes new value to the back of the vector. Beyond the inline
+     *        capacity, the capacity grows geometrically on the heap.
+     *
+     * @param value Reference to the new value to push to the vector.
+     *
+     * @return True if the value was pushed to the back of the vector, else false.
+     ********************************************************************************/
+    bool pushBack(const T& value);
+
+    /********************************************************************************
+     * @brief Pushes new value to the back of the vector. The value is moved
+     *        instead of copied.
+     *
+     * @param value Reference to the new value to move to the vector.
+     *
+     * @return True if the value was pushed to the back of the vector, else false.
+     ********************************************************************************/
+    bool pushBack(T&& value);
+
+    /********************************************************************************
+     * @brief Constructs new value in place at the back of the vector.
+     *
+     * @tparam Args The types of the constructor arguments.
+     *
+     * @param args The arguments passed to the constructor of the new value.
+     *
+     * @return True if the value was constructed, else false.
+     ********************************************************************************/
+    template <typename... Args>
+    bool emplaceBack(Args&&... args);
+
+    /********************************************************************************
+     * @brief Pops value at the back of the vector. The capacity is retained.
+     *
+     * @return True if the last value of the vector was popped, else false.
+     ********************************************************************************/
+    bool popBack();
+
+protected:
+    T* inlineData();
+    bool addValues(const SmallVector<T, N>& source);
+    template <size_t NumValues>
+    bool addValues(const T (&values)[NumValues]);
+    void append(const T* values, const size_t numValues);
+    void takeFrom(SmallVector<T, N>& source);
+    bool grow(const size_t minCapacity);
+    void destroy(const size_t first, const size_t last);
+    bool reallocate(const size_t newCapacity);
+
+    alignas(T) uint8_t myBuffer[N * sizeof(T)];
+    T* myData{inlineData()};
+    size_t mySize{};
+    size_t myCapacity{N};
+};
+
+} // namespace container
+
+#include "small_vector_impl.h"
@@ -0,0 +1,397 @@
+/********************************************************************************
+ * @brief Implementation details of the container::SmallVector class.
+ * 
+ * @note Don't include this header, use <small_vector.h> instead!
+ ********************************************************************************/
+#pragma once 
+
+#include <string.h>
+
+#include "type_traits.h"
+#include "utils.h"
+
+namespace container
+{
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+SmallVector<T, N>::SmallVector() = default;
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+SmallVector<T, N>::SmallVector(const size_t size) { resize(size); }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+template <typename... Values>
+SmallVector<T, N>::SmallVector(const Values&&... values) 
+{
+    const T array[sizeof...(values)]{(values)...};
+    addValues(array);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+SmallVector<T, N>::SmallVector(const SmallVector<T, N>& source) 
+{
+    if (reserve(source.mySize)) { append(source.myData, source.mySize); }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+SmallVector<T, N>::SmallVector(SmallVector<T, N>&& source) noexcept 
+{
+    takeFrom(source);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+SmallVector<T, N>::~SmallVector() { clear(); }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+T& SmallVector<T, N>::operator[](const size_t index) { return myData[index]; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+const T& SmallVector<T, N>::operator[](const size_t index) const 
+{ 
+    return myData[index]; 
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+template <typename... Values>
+void SmallVector<T, N>::operator=(const Values&&... values) 
+{
+    const T array[sizeof...(values)]{(values)...};
+    destroy(0, mySize);
+    mySize = 0;
+    addValues(array);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+void SmallVector<T, N>::operator=(const SmallVector<T, N>& source) 
+{
+    if (this == &source) { return; }
+    destroy(0, mySize);
+    mySize = 0;
+    if (reserve(source.mySize)) { append(source.myData, source.mySize); }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+void SmallVector<T, N>::operator=(SmallVector<T, N>&& source) noexcept 
+{
+    if (this == &source) { return; }
+    clear();
+    takeFrom(source);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+template <size_t NumValues>
+void SmallVector<T, N>::operator+=(const T (&values)[NumValues]) { addValues(values); }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+void SmallVector<T, N>::operator+=(const SmallVector<T, N>& source) { addValues(source); }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+const T* SmallVector<T, N>::data() const { return myData; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+size_t SmallVector<T, N>::size() const { return mySize; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+size_t SmallVector<T, N>::capacity() const { return myCapacity; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+bool SmallVector<T, N>::empty() const { return mySize == 0; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+bool SmallVector<T, N>::isInline() const 
+{ 
+    return myData == reinterpret_cast<const T*>(myBuffer); 
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+typename SmallVector<T, N>::Iterator SmallVector<T, N>::begin() 
+{ 
+    return Iterator{myData}; 
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+typename SmallVector<T, N>::ConstIterator SmallVector<T, N>::begin() const 
+{ 
+    return ConstIterator{myData};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+typename SmallVector<T, N>::Iterator SmallVector<T, N>::end() 
+{ 
+    return Iterator{myData + mySize}; 
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+typename SmallVector<T, N>::ConstIterator SmallVector<T, N>::end() const 
+{ 
+    return ConstIterator{myData + mySize};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+typename SmallVector<T, N>::Iterator SmallVector<T, N>::rbegin() 
+{ 
+    return mySize > 0 ? Iterator{myData + mySize - 1} : Iterator{nullptr}; 
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+typename SmallVector<T, N>::ConstIterator SmallVector<T, N>::rbegin() const 
+{ 
+    return mySize > 0 ? ConstIterator{myData + mySize - 1} : ConstIterator{nullptr}; 
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+typename SmallVector<T, N>::Iterator SmallVector<T, N>::rend() 
+{ 
+    return mySize > 0 ? Iterator{myData - 1} : Iterator{nullptr};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+typename SmallVector<T, N>::ConstIterator SmallVector<T, N>::rend() const 
+{ 
+    return mySize > 0 ? ConstIterator{myData - 1} : ConstIterator{nullptr};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+T* SmallVector<T, N>::last() { return mySize > 0 ? myData + mySize - 1 : nullptr; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+const T* SmallVector<T, N>::last() const 
+{ 
+    return mySize > 0 ? myData + mySize - 1 : nullptr; 
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+void SmallVector<T, N>::clear() 
+{
+    destroy(0, mySize);
+    if (!isInline()) { utils::deleteMemory<T>(myData); }
+    myData = inlineData();
+    mySize = 0;
+    myCapacity = N;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+bool SmallVector<T, N>::resize(const size_t newSize) 
+{
+    if (!reserve(newSize)) { return false; }
+    for (size_t i{mySize}; i < newSize; ++i) { utils::construct(myData + i); }
+    destroy(newSize, mySize);
+    mySize = newSize;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+bool SmallVector<T, N>::reserve(const size_t newCapacity) 
+{
+    return newCapacity <= myCapacity || reallocate(newCapacity);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+bool SmallVector<T, N>::shrinkToFit() 
+{
+    if (isInline() || mySize == myCapacity) { return true; }
+    return reallocate(mySize);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+bool SmallVector<T, N>::pushBack(const T& value) 
+{
+    return emplaceBack(value);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+bool SmallVector<T, N>::pushBack(T&& value) 
+{
+    return emplaceBack(utils::move(value));
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+template <typename... Args>
+bool SmallVector<T, N>::emplaceBack(Args&&... args) 
+{
+    if (mySize < myCapacity) 
+    {
+        utils::construct(myData + mySize, utils::forward<Args>(args)...);
+    }
+    else 
+    {
+        // The arguments may refer to elements of the vector, hence the value is
+        // constructed before the elements are relocated.
+        T value(utils::forward<Args>(args)...);
+        if (!grow(mySize + 1)) { return false; }
+        utils::construct(myData + mySize, utils::move(value));
+    }
+    mySize++;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+bool SmallVector<T, N>::popBack() 
+{
+    if (mySize > 0) { utils::destroy(myData + --mySize); }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+T* SmallVector<T, N>::inlineData() { return reinterpret_cast<T*>(myBuffer); }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+bool SmallVector<T, N>::addValues(const SmallVector<T, N>& source) 
+{
+    // The source is read after growing, since it may be this vector.
+    const auto count{source.mySize};
+    if (!grow(mySize + count)) { return false; }
+    append(source.myData, count);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+template <size_t NumValues>
+bool SmallVector<T, N>::addValues(const T (&values)[NumValues]) 
+{
+    if (!grow(mySize + NumValues)) { return false; }
+    append(values, NumValues);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+void SmallVector<T, N>::append(const T* values, const size_t numValues) 
+{
+    if constexpr (type_traits::is_trivially_copyable<T>::value)
+    {
+        memcpy(myData + mySize, values, numValues * sizeof(T));
+        mySize += numValues;
+    }
+    else
+    {
+        for (size_t i{}; i < numValues; ++i) 
+        {
+            utils::construct(myData + mySize, values[i]);
+            mySize++;
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+void SmallVector<T, N>::takeFrom(SmallVector<T, N>& source) 
+{
+    // Heap memory is handed over, but inline elements live inside the source
+    // and must be moved into the inline storage of this vector.
+    if (source.isInline()) 
+    {
+        for (size_t i{}; i < source.mySize; ++i) 
+        {
+            utils::construct(myData + i, utils::move(source.myData[i]));
+        }
+        mySize = source.mySize;
+        source.destroy(0, source.mySize);
+    }
+    else 
+    {
+        myData = source.myData;
+        mySize = source.mySize;
+        myCapacity = source.myCapacity;
+        source.myData = source.inlineData();
+        source.myCapacity = N;
+    }
+    source.mySize = 0;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+bool SmallVector<T, N>::grow(const size_t minCapacity) 
+{
+    if (minCapacity <= myCapacity) { return true; }
+    const auto geometric{myCapacity + myCapacity / 2};
+    return reallocate(geometric > minCapacity ? geometric : minCapacity);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+bool SmallVector<T, N>::reallocate(const size_t newCapacity) 
+{
+    // Capacities that fit the inline storage move the elements back into it.
+    const bool toInline{newCapacity <= N};
+    if (toInline && isInline()) { return true; }
+
+    if constexpr (type_traits::is_trivially_copyable<T>::value)
+    {
+        if (!toInline && !isInline())
+        {
+            auto block{utils::reallocMemory<T>(myData, newCapacity)};
+            if (block == nullptr) { return false; }
+            myData = block;
+            myCapacity = newCapacity;
+            if (mySize > newCapacity) { mySize = newCapacity; }
+            return true;
+        }
+    }
+
+    auto block{toInline ? inlineData() : utils::newMemory<T>(newCapacity)};
+    if (block == nullptr) { return false; }
+    const auto count{mySize < newCapacity ? mySize : newCapacity};
+
+    for (size_t i{}; i < count; ++i) 
+    {
+        utils::construct(block + i, utils::move(myData[i]));
+    }
+    destroy(0, mySize);
+    if (!isInline()) { utils::deleteMemory<T>(myData); }
+    myData = block;
+    mySize = count;
+    myCapacity = toInline ? N : newCapacity;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+void SmallVector<T, N>::destroy(const size_t first, const size_t last) 
+{
+    if constexpr (!type_traits::is_trivially_destructible<T>::value)
+    {
+        for (size_t i{first}; i < last; ++i) { utils::destroy(myData + i); }
+    }
+}
+
+} // namespace container
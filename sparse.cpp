@@ -0,0 +1,117 @@
+/********************************************************************************
+ * @brief Implementation details of the sparse least squares solver.
+ ********************************************************************************/
+#include <math.h>
+#include <stdint.h>
+
+#include "sparse.h"
+
+namespace ml
+{
+namespace
+{
+
+// -----------------------------------------------------------------------------
+double dot(const double* x, const double* y, const uint32_t size)
+{
+    double sum{};
+    for (uint32_t i{}; i < size; ++i) { sum += x[i] * y[i]; }
+    return sum;
+}
+
+} // namespace
+
+// -----------------------------------------------------------------------------
+void multiply(const SparseMatrix& matrix, const double* input, double* output,
+              const uint32_t firstRow, const uint32_t lastRow)
+{
+    for (uint32_t i{firstRow}; i < lastRow; ++i)
+    {
+        double sum{};
+        for (uint32_t j{matrix.rowOffsets[i]}; j < matrix.rowOffsets[i + 1U]; ++j)
+        {
+            sum += matrix.values[j] * input[matrix.columns[j]];
+        }
+        output[i] = sum;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void multiplyTransposed(const SparseMatrix& matrix, const double* input, double* output)
+{
+    for (uint32_t i{}; i < matrix.columnCount; ++i) { output[i] = 0.0; }
+
+    for (uint32_t i{}; i < matrix.rows; ++i)
+    {
+        for (uint32_t j{matrix.rowOffsets[i]}; j < matrix.rowOffsets[i + 1U]; ++j)
+        {
+            output[matrix.columns[j]] += matrix.values[j] * input[i];
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+CglsSolver::CglsSolver(const uint16_t maxIterations, const double tolerance)
+    : myTolerance{tolerance}
+    , myMaxIterations{maxIterations}
+{
+}
+
+// -----------------------------------------------------------------------------
+bool CglsSolver::reserve(const uint32_t rows, const uint32_t columnCount)
+{
+    // The sizes are added in 32 bits, since size_t is only 16 bits on AVR.
+    const uint32_t count{rows + columnCount};
+    if (count < rows || count > SIZE_MAX / 2U) { return false; }
+    const size_t size{static_cast<size_t>(2U * count)};
+    return myWorkspace.size() >= size || myWorkspace.resize(size);
+}
+
+// -----------------------------------------------------------------------------
+bool CglsSolver::solve(const SparseMatrix& matrix, const double* outputs, double* coefficients)
+{
+    myIterations = 0U;
+    if (!reserve(matrix.rows, matrix.columnCount)) { return false; }
+
+    double* residual{&myWorkspace[0U]};
+    double* product{residual + matrix.rows};
+    double* gradient{product + matrix.rows};
+    double* direction{gradient + matrix.columnCount};
+
+    multiply(matrix, coefficients, residual, 0U, matrix.rows);
+    for (uint32_t i{}; i < matrix.rows; ++i) { residual[i] = outputs[i] - residual[i]; }
+    multiplyTransposed(matrix, residual, gradient);
+    for (uint32_t i{}; i < matrix.columnCount; ++i) { direction[i] = gradient[i]; }
+
+    double gamma{dot(gradient, gradient, matrix.columnCount)};
+    const double limit{myTolerance * myTolerance * gamma};
+
+    while (gamma > limit && gamma > 0.0)
+    {
+        if (myIterations == myMaxIterations) { return false; }
+        myIterations++;
+
+        multiply(matrix, direction, product, 0U, matrix.rows);
+        const double curvature{dot(product, product, matrix.rows)};
+        if (curvature <= 0.0) { return false; }
+        const double step{gamma / curvature};
+
+        for (uint32_t i{}; i < matrix.columnCount; ++i) { coefficients[i] += step * direction[i]; }
+        for (uint32_t i{}; i < matrix.rows; ++i) { residual[i] -= step * product[i]; }
+
+        multiplyTransposed(matrix, residual, gradient);
+        const double nextGamma{dot(gradient, gradient, matrix.columnCount)};
+        const double beta{nextGamma / gamma};
+        for (uint32_t i{}; i < matrix.columnCount; ++i)
+        {
+            direction[i] = gradient[i] + beta * direction[i];
+        }
+        gamma = nextGamma;
+    }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+uint16_t CglsSolver::iterations() const { return myIterations; }
+
+} // namespace ml
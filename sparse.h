@@ -0,0 +1,124 @@
+/********************************************************************************
+ * @brief Sparse linear regression via compressed sparse row (CSR) matrices and
+ *        a conjugate gradient least squares (CGLS) solver.
+ ********************************************************************************/
+#pragma once
+
+#include <stdint.h>
+
+#include "vector.h"
+
+namespace ml
+{
+
+/********************************************************************************
+ * @brief View of a sparse matrix stored in compressed sparse row format. The
+ *        non-zero values of row i are stored at indexes rowOffsets[i] up to
+ *        (but not including) rowOffsets[i + 1] of the value and column tables,
+ *        hence the offset table holds rows + 1 entries. The tables are viewed,
+ *        not copied, so they must outlive the view.
+ *
+ * @param values      Pointer to the non-zero values.
+ * @param columns     Pointer to the column index of each non-zero value.
+ * @param rowOffsets  Pointer to the row offset table.
+ * @param rows        The number of rows.
+ * @param columnCount The number of columns.
+ ********************************************************************************/
+struct SparseMatrix
+{
+    const double* values;
+    const uint32_t* columns;
+    const uint32_t* rowOffsets;
+    uint32_t rows;
+    uint32_t columnCount;
+};
+
+/********************************************************************************
+ * @brief Calculates rows firstRow up to (but not including) lastRow of the
+ *        product of a sparse matrix and a dense vector. Every row only writes
+ *        its own output entry, so disjoint row ranges can be calculated
+ *        concurrently without any locking.
+ *
+ * @param matrix   Reference to the sparse matrix.
+ * @param input    Pointer to the dense vector, one value per column.
+ * @param output   Pointer to the output vector, one value per row.
+ * @param firstRow Index of the first row to calculate.
+ * @param lastRow  Index one past the last row to calculate.
+ ********************************************************************************/
+void multiply(const SparseMatrix& matrix, const double* input, double* output,
+              const uint32_t firstRow, const uint32_t lastRow);
+
+/********************************************************************************
+ * @brief Calculates the product of the transpose of a sparse matrix and a
+ *        dense vector.
+ *
+ * @param matrix Reference to the sparse matrix.
+ * @param input  Pointer to the dense vector, one value per row.
+ * @param output Pointer to the output vector, one value per column.
+ ********************************************************************************/
+void multiplyTransposed(const SparseMatrix& matrix, const double* input, double* output);
+
+/********************************************************************************
+ * @brief Class for solving sparse least squares problems with the conjugate
+ *        gradient method on the normal equations (CGLS), which only needs
+ *        products with the matrix and its transpose, so X^T * X is never
+ *        formed. The workspace (two vectors per row and two per column) is
+ *        kept between solves and only grows when a larger problem is solved.
+ *
+ * @note A bias must be modeled as a column of ones in the matrix.
+ ********************************************************************************/
+class CglsSolver
+{
+public:
+
+    /********************************************************************************
+     * @brief Creates new solver.
+     *
+     * @param maxIterations The maximum number of iterations per solve
+     *                      (default = 100).
+     * @param tolerance     The relative gradient norm at which a solve is
+     *                      considered converged (default = 1e-6).
+     ********************************************************************************/
+    explicit CglsSolver(const uint16_t maxIterations = 100U, const double tolerance = 1e-6);
+
+    /********************************************************************************
+     * @brief Preallocates the workspace for problems of specified size.
+     *
+     * @param rows        The maximum number of rows.
+     * @param columnCount The maximum number of columns.
+     *
+     * @return True if the workspace was allocated, else false if the allocation
+     *         failed or the workspace size doesn't fit in size_t.
+     ********************************************************************************/
+    bool reserve(const uint32_t rows, const uint32_t columnCount);
+
+    /********************************************************************************
+     * @brief Solves the least squares problem min |matrix * coefficients - outputs|.
+     *
+     * @param matrix       Reference to the sparse matrix.
+     * @param outputs      Pointer to the output values, one per row.
+     * @param coefficients Pointer to the coefficients, one per column. The
+     *                     current values are used as the initial guess.
+     *
+     * @return True if the solve converged, false if the workspace couldn't be
+     *         allocated, the maximum number of iterations was reached or the
+     *         iteration broke down numerically, in which case the coefficients
+     *         hold the last iterate.
+     ********************************************************************************/
+    bool solve(const SparseMatrix& matrix, const double* outputs, double* coefficients);
+
+    /********************************************************************************
+     * @brief Provides the number of iterations used by the last solve.
+     *
+     * @return The number of iterations.
+     ********************************************************************************/
+    uint16_t iterations() const;
+
+private:
+    container::Vector<double> myWorkspace{};
+    double myTolerance;
+    uint16_t myMaxIterations;
+    uint16_t myIterations{};
+};
+
+} // namespace ml
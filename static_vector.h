@@ -0,0 +1,239 @@
+/********************************************************************************
+ * @brief Implementation of fixed-capacity vectors without heap allocation.
+ ********************************************************************************/
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "array.h"
+#include "type_traits.h"
+
+namespace container
+{
+/********************************************************************************
+ * @brief Class for implementation of fixed-capacity vectors. The elements are
+ *        stored in a static array, so the vector never allocates memory and
+ *        can be filled from an interrupt routine. The values can be used as
+ *        training data via a dataset view, e.g.
+ *        ml::Dataset{input.data(), output.data(), input.size()}.
+ *
+ * @tparam T        The data type of the vector.
+ * @tparam Capacity The maximum number of elements the vector can hold.
+ *
+ * @note Sharing a vector between an interrupt routine and the main program
+ *       requires a single writer: only one context (the interrupt routine or
+ *       the main program) may modify the vector, the other may only read it.
+ *       The writer publishes the new size after each element is written, so
+ *       the reader never sees unwritten elements. The size is stored in a
+ *       single byte for capacities up to 255, so it can be read atomically;
+ *       for larger capacities, read the size with interrupts disabled, e.g.
+ *       in an ATOMIC_BLOCK. If both contexts need to modify the vector, every
+ *       modification in the main program must run with interrupts disabled.
+ ********************************************************************************/
+template <typename T, size_t Capacity>
+class StaticVector
+{
+public:
+    using Iterator = typename Array<T, Capacity>::Iterator;
+    using ConstIterator = typename Array<T, Capacity>::ConstIterator;
+
+    /********************************************************************************
+     * @brief Creates empty vector.
+     ********************************************************************************/
+    StaticVector();
+
+    /********************************************************************************
+     * @brief Creates vector containing specified values.
+     *
+     * @tparam Values Parameter pack containing values.
+     *
+     * @param values The values to add to the vector.
+     ********************************************************************************/
+    template <typename... Values>
+    StaticVector(const Values&&... values);
+
+    /********************************************************************************
+     * @brief Returns reference to the element at specified index in the vector.
+     *
+     * @param index Index of the requested element.
+     *
+     * @return A reference to the element at specified index.
+     ********************************************************************************/
+    T& operator[](const size_t index);
+
+    /********************************************************************************
+     * @brief Returns reference to the element at specified index in the vector.
+     *
+     * @param index Index of the requested element.
+     *
+     * @return A reference to the element at specified index.
+     ********************************************************************************/
+    const T& operator[](const size_t index) const;
+
+    /********************************************************************************
+     * @brief Provides the data held by the vector.
+     *
+     * @return Pointer to the start address of the vector.
+     ********************************************************************************/
+    T* data();
+
+    /********************************************************************************
+     * @brief Provides the data held by the vector.
+     *
+     * @return Pointer to the start address of the vector.
+     ********************************************************************************/
+    const T* data() const;
+
+    /********************************************************************************
+     * @brief Returns the size of the vector in the number of elements it holds.
+     *
+     * @return The size of the vector as an unsigned integer.
+     ********************************************************************************/
+    size_t size() const;
+
+    /********************************************************************************
+     * @brief Returns the capacity of the vector, i.e. the maximum number of
+     *        elements it can hold.
+     *
+     * @return The capacity of the vector as an unsigned integer.
+     ********************************************************************************/
+    size_t capacity() const;
+
+    /********************************************************************************
+     * @brief Indicates if the vector is empty.
+     *
+     * @return True if the vector is empty, else false.
+     ********************************************************************************/
+    bool empty() const;
+
+    /********************************************************************************
+     * @brief Indicates if the vector is full.
+     *
+     * @return True if the vector is full, else false.
+     ********************************************************************************/
+    bool full() const;
+
+    /********************************************************************************
+     * @brief Provides the start address of the vector.
+     *
+     * @return Iterator pointing at the start address of the the vector.
+     ********************************************************************************/
+    Iterator begin();
+
+    /********************************************************************************
+     * @brief Provides the start address of the vector.
+     *
+     * @return Iterator pointing at the start address of the the vector.
+     ********************************************************************************/
+    ConstIterator begin() const;
+
+    /********************************************************************************
+     * @brief Provides the end address of the vector.
+     *
+     * @return Iterator pointing at the end address of the the vector.
+     ********************************************************************************/
+    Iterator end();
+
+    /********************************************************************************
+     * @brief Provides the end address of the vector.
+     *
+     * @return Iterator pointing at the end address of the the vector.
+     ********************************************************************************/
+    ConstIterator end() const;
+
+    /********************************************************************************
+     * @brief Returns the address of the last element of the vector.
+     *
+     * @return Pointer to the last element of the vector.
+     ********************************************************************************/
+    T* last();
+
+    /********************************************************************************
+     * @brief Returns the address of the last element of the vector.
+     *
+     * @return Pointer to the last element of the vector.
+     ********************************************************************************/
+    const T* last() const;
+
+    /********************************************************************************
+     * @brief Clears content of the vector.
+     ********************************************************************************/
+    void clear();
+
+    /********************************************************************************
+     * @brief Resizes the vector to specified new size. New elements are
+     *        default-initialized.
+     *
+     * @param newSize The new size of the vector.
+     *
+     * @return True if the vector was resized, else false if the new size exceeds
+     *         the capacity.
+     ********************************************************************************/
+    bool resize(const size_t newSize);
+
+    /********************************************************************************
+     * @brief Pushes new value to the back of the vector.
+     *
+     * @param value Reference to the new value to push to the vector.
+     *
+     * @return True if the value was pushed to the back of the vector, else false
+     *         if the vector is full.
+     ********************************************************************************/
+    bool pushBack(const T& value);
+
+    /********************************************************************************
+     * @brief Pushes new value to the back of the vector. The value is moved
+     *        instead of copied.
+     *
+     * @param value Reference to the new value to move to the vector.
+     *
+     * @return True if the value was pushed to the back of the vector, else false
+     *         if the vector is full.
+     ********************************************************************************/
+    bool pushBack(T&& value);
+
+    /********************************************************************************
+     * @brief Pops value at the back of the vector.
+     *
+     * @return True if the last value of the vector was popped, else false.
+     ********************************************************************************/
+    bool popBack();
+
+    /********************************************************************************
+     * @brief Inserts new value at specified index. Subsequent values are shifted
+     *        one step towards the back of the vector.
+     *
+     * @param index The index at which to insert the value. An index equal to the
+     *              size of the vector pushes the value to the back.
+     * @param value Reference to the value to insert.
+     *
+     * @return True if the value was inserted, else false if the index is out of
+     *         range or the vector is full.
+     ********************************************************************************/
+    bool insert(const size_t index, const T& value);
+
+    /********************************************************************************
+     * @brief Erases the value at specified index. Subsequent values are shifted
+     *        one step towards the front of the vector.
+     *
+     * @param index The index of the value to erase.
+     *
+     * @return True if the value was erased, else false if the index is out of
+     *         range.
+     ********************************************************************************/
+    bool erase(const size_t index);
+
+protected:
+    using SizeType = typename type_traits::conditional<(Capacity <= UINT8_MAX),
+                                                        uint8_t, size_t>::type;
+    void shift(const size_t destination, const size_t source, const size_t count);
+    void reset(const size_t first, const size_t last);
+
+    Array<T, Capacity> myData{};
+    volatile SizeType mySize{};
+};
+
+} // namespace container
+
+#include "static_vector_impl.h"
@@ -0,0 +1,239 @@
+/********************************************************************************
+ * @brief Implementation details of the container::StaticVector class.
+ *
+ * @note Don't include this header, use <static_vector.h> instead!
+ ********************************************************************************/
+#pragma once
+
+#include <string.h>
+
+#include "utils.h"
+
+namespace container
+{
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+StaticVector<T, Capacity>::StaticVector() = default;
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+template <typename... Values>
+StaticVector<T, Capacity>::StaticVector(const Values&&... values)
+{
+    static_assert(sizeof...(values) <= Capacity,
+                  "The number of values cannot exceed the capacity!");
+    const T array[sizeof...(values)]{(values)...};
+    for (const auto& value : array) { pushBack(value); }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+T& StaticVector<T, Capacity>::operator[](const size_t index) { return myData[index]; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+const T& StaticVector<T, Capacity>::operator[](const size_t index) const
+{
+    return myData[index];
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+T* StaticVector<T, Capacity>::data() { return myData.data(); }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+const T* StaticVector<T, Capacity>::data() const { return myData.data(); }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+size_t StaticVector<T, Capacity>::size() const { return mySize; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+size_t StaticVector<T, Capacity>::capacity() const { return Capacity; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+bool StaticVector<T, Capacity>::empty() const { return mySize == 0; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+bool StaticVector<T, Capacity>::full() const { return mySize == Capacity; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+typename StaticVector<T, Capacity>::Iterator StaticVector<T, Capacity>::begin()
+{
+    return Iterator{data()};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+typename StaticVector<T, Capacity>::ConstIterator StaticVector<T, Capacity>::begin() const
+{
+    return ConstIterator{data()};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+typename StaticVector<T, Capacity>::Iterator StaticVector<T, Capacity>::end()
+{
+    return Iterator{data() + mySize};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+typename StaticVector<T, Capacity>::ConstIterator StaticVector<T, Capacity>::end() const
+{
+    return ConstIterator{data() + mySize};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+T* StaticVector<T, Capacity>::last()
+{
+    const SizeType size{mySize};
+    return size > 0 ? data() + size - 1 : nullptr;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+const T* StaticVector<T, Capacity>::last() const
+{
+    const SizeType size{mySize};
+    return size > 0 ? data() + size - 1 : nullptr;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+void StaticVector<T, Capacity>::clear() { resize(0); }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+bool StaticVector<T, Capacity>::resize(const size_t newSize)
+{
+    if (newSize > Capacity) { return false; }
+    const SizeType size{mySize};
+
+    // Popped elements may still hold their old values, hence new elements are
+    // reset explicitly.
+    if (newSize > size)
+    {
+        for (size_t i{size}; i < newSize; ++i) { myData[i] = T{}; }
+        utils::memoryBarrier();
+        mySize = static_cast<SizeType>(newSize);
+    }
+    else
+    {
+        mySize = static_cast<SizeType>(newSize);
+        reset(newSize, size);
+    }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+bool StaticVector<T, Capacity>::pushBack(const T& value)
+{
+    const SizeType size{mySize};
+    if (size >= Capacity) { return false; }
+    myData[size] = value;
+    utils::memoryBarrier();
+    mySize = size + 1;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+bool StaticVector<T, Capacity>::pushBack(T&& value)
+{
+    const SizeType size{mySize};
+    if (size >= Capacity) { return false; }
+    myData[size] = utils::move(value);
+    utils::memoryBarrier();
+    mySize = size + 1;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+bool StaticVector<T, Capacity>::popBack()
+{
+    const SizeType size{mySize};
+    if (size > 0)
+    {
+        mySize = size - 1;
+        reset(size - 1, size);
+    }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+bool StaticVector<T, Capacity>::insert(const size_t index, const T& value)
+{
+    const SizeType size{mySize};
+    if (index > size || size >= Capacity) { return false; }
+
+    // The value is copied before shifting, since it may be an element of the
+    // vector itself.
+    T element{value};
+    shift(index + 1, index, size - index);
+    myData[index] = utils::move(element);
+    utils::memoryBarrier();
+    mySize = size + 1;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+bool StaticVector<T, Capacity>::erase(const size_t index)
+{
+    const SizeType size{mySize};
+    if (index >= size) { return false; }
+    shift(index, index + 1, size - index - 1);
+    mySize = size - 1;
+    reset(size - 1, size);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+void StaticVector<T, Capacity>::shift(const size_t destination, const size_t source,
+                                      const size_t count)
+{
+    if constexpr (type_traits::is_trivially_copyable<T>::value)
+    {
+        memmove(data() + destination, data() + source, count * sizeof(T));
+    }
+    else if (destination < source)
+    {
+        for (size_t i{}; i < count; ++i)
+        {
+            myData[destination + i] = utils::move(myData[source + i]);
+        }
+    }
+    else
+    {
+        for (size_t i{count}; i > 0; --i)
+        {
+            myData[destination + i - 1] = utils::move(myData[source + i - 1]);
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+void StaticVector<T, Capacity>::reset(const size_t first, const size_t last)
+{
+    // Elements outside the vector stay constructed in the array, hence
+    // elements owning resources are reset to release them.
+    if constexpr (!type_traits::is_trivially_destructible<T>::value)
+    {
+        for (size_t i{first}; i < last; ++i) { myData[i] = T{}; }
+    }
+}
+
+} // namespace container
@@ -0,0 +1,88 @@
+/********************************************************************************
+ * @brief Implementation details of the sufficient statistics class.
+ ********************************************************************************/
+#include "statistics.h"
+
+namespace ml
+{
+
+// -----------------------------------------------------------------------------
+void Statistics::add(const double input, const double output)
+{
+    myCount++;
+    const double deltaInput{input - myMeanInput};
+    const double deltaOutput{output - myMeanOutput};
+    myMeanInput += deltaInput / myCount;
+    myMeanOutput += deltaOutput / myCount;
+    mySumSquaresInput += deltaInput * (input - myMeanInput);
+    mySumSquaresOutput += deltaOutput * (output - myMeanOutput);
+    mySumProducts += deltaInput * (output - myMeanOutput);
+}
+
+// -----------------------------------------------------------------------------
+void Statistics::add(const double* input, const double* output, const uint32_t count)
+{
+    for (uint32_t i{}; i < count; ++i)
+    {
+        add(input[i], output[i]);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void Statistics::merge(const Statistics& other)
+{
+    if (other.myCount == 0U) { return; }
+    if (myCount == 0U)
+    {
+        *this = other;
+        return;
+    }
+    const double count{static_cast<double>(myCount) + other.myCount};
+    const double factor{static_cast<double>(myCount) * other.myCount / count};
+    const double deltaInput{other.myMeanInput - myMeanInput};
+    const double deltaOutput{other.myMeanOutput - myMeanOutput};
+
+    mySumSquaresInput += other.mySumSquaresInput + deltaInput * deltaInput * factor;
+    mySumSquaresOutput += other.mySumSquaresOutput + deltaOutput * deltaOutput * factor;
+    mySumProducts += other.mySumProducts + deltaInput * deltaOutput * factor;
+    myMeanInput += deltaInput * other.myCount / count;
+    myMeanOutput += deltaOutput * other.myCount / count;
+    myCount += other.myCount;
+}
+
+// -----------------------------------------------------------------------------
+void Statistics::clear() { *this = Statistics{}; }
+
+// -----------------------------------------------------------------------------
+uint32_t Statistics::count() const { return myCount; }
+
+// -----------------------------------------------------------------------------
+double Statistics::meanInput() const { return myMeanInput; }
+
+// -----------------------------------------------------------------------------
+double Statistics::meanOutput() const { return myMeanOutput; }
+
+// -----------------------------------------------------------------------------
+bool Statistics::solve(double& bias, double& weight) const
+{
+    if (myCount == 0U || mySumSquaresInput <= 0.0)
+    {
+        bias = myMeanOutput;
+        weight = 0.0;
+        return false;
+    }
+    weight = mySumProducts / mySumSquaresInput;
+    bias = myMeanOutput - weight * myMeanInput;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+double Statistics::residual() const
+{
+    if (mySumSquaresInput <= 0.0) { return mySumSquaresOutput; }
+    const double residual{mySumSquaresOutput - 
+        mySumProducts * mySumProducts / mySumSquaresInput};
+    return residual > 0.0 ? residual : 0.0;
+}
+
+} // namespace ml
@@ -0,0 +1,120 @@
+/********************************************************************************
+ * @brief Sufficient statistics for closed-form fitting of linear regression
+ *        models in a single pass over the training data.
+ ********************************************************************************/
+#pragma once
+
+#include <stdint.h>
+
+namespace ml
+{
+
+/********************************************************************************
+ * @brief Coefficients of a fitted linear regression model.
+ *
+ * @param bias   The fitted bias.
+ * @param weight The fitted weight.
+ ********************************************************************************/
+struct Coefficients
+{
+    double bias{};
+    double weight{};
+};
+
+/********************************************************************************
+ * @brief Class for accumulating the sufficient statistics of a set of training
+ *        samples, i.e. the sample count, the means and the (co)variance sums.
+ *        The means are updated incrementally (Welford's method), which keeps
+ *        the accumulation numerically stable even with single-precision
+ *        doubles, as is the case on AVR.
+ ********************************************************************************/
+class Statistics
+{
+public:
+
+    /********************************************************************************
+     * @brief Creates empty statistics.
+     ********************************************************************************/
+    Statistics() = default;
+
+    /********************************************************************************
+     * @brief Adds a training sample to the statistics.
+     *
+     * @param input  The input value of the sample.
+     * @param output The output value of the sample.
+     ********************************************************************************/
+    void add(const double input, const double output);
+
+    /********************************************************************************
+     * @brief Adds a contiguous block of training samples to the statistics.
+     *
+     * @param input  Pointer to the input values of the samples.
+     * @param output Pointer to the output values of the samples.
+     * @param count  The number of samples to add.
+     ********************************************************************************/
+    void add(const double* input, const double* output, const uint32_t count);
+
+    /********************************************************************************
+     * @brief Merges referenced statistics into these statistics. The result is
+     *        the same as if all samples had been added to one instance.
+     *
+     * @param other Reference to the statistics to merge.
+     ********************************************************************************/
+    void merge(const Statistics& other);
+
+    /********************************************************************************
+     * @brief Clears the statistics.
+     ********************************************************************************/
+    void clear();
+
+    /********************************************************************************
+     * @brief Provides the number of added samples.
+     *
+     * @return The number of added samples.
+     ********************************************************************************/
+    uint32_t count() const;
+
+    /********************************************************************************
+     * @brief Provides the mean of the added input values.
+     *
+     * @return The mean input value.
+     ********************************************************************************/
+    double meanInput() const;
+
+    /********************************************************************************
+     * @brief Provides the mean of the added output values.
+     *
+     * @return The mean output value.
+     ********************************************************************************/
+    double meanOutput() const;
+
+    /********************************************************************************
+     * @brief Solves the least squares problem for the added samples.
+     *
+     * @param bias   Reference to variable for storing the fitted bias.
+     * @param weight Reference to variable for storing the fitted weight.
+     *
+     * @return True if the coefficients were solved, false if the input values
+     *         don't vary (or no samples were added), in which case the bias
+     *         is set to the mean output and the weight to 0.
+     ********************************************************************************/
+    bool solve(double& bias, double& weight) const;
+
+    /********************************************************************************
+     * @brief Provides the residual sum of squares of the least squares fit of
+     *        the added samples.
+     *
+     * @return The sum of the squared residuals of the fitted line.
+     ********************************************************************************/
+    double residual() const;
+
+private:
+    uint32_t myCount{};
+    double myMeanInput{};
+    double myMeanOutput{};
+    double mySumSquaresInput{};
+    double mySumSquaresOutput{};
+    double mySumProducts{};
+};
+
+} // namespace ml
@@ -0,0 +1,116 @@
+/********************************************************************************
+ * @brief Out-of-core training of linear regression models, where the training
+ *        data is consumed in fixed-size chunks from an external source.
+ ********************************************************************************/
+#pragma once
+
+#include "array.h"
+#include "statistics.h"
+
+namespace ml
+{
+
+/********************************************************************************
+ * @brief Class for training linear regression models on datasets that don't fit
+ *        in memory. The training data is read chunk by chunk into a buffer of
+ *        fixed size, so memory use is bounded by the chunk size regardless of
+ *        the size of the dataset.
+ *
+ * @tparam ChunkSize The number of samples read from the source at a time.
+ *
+ * @note The chunk size must exceed 0, else a compilation error will be generated.
+ ********************************************************************************/
+template <size_t ChunkSize>
+class StreamTrainer
+{
+public:
+
+    /********************************************************************************
+     * @brief Source of training data. The source reads up to count samples,
+     *        starting at sample index first, into the referenced buffers.
+     *        The source returns the number of samples read, where 0 indicates
+     *        the end of the dataset. A source returning more than count samples
+     *        is treated as an error.
+     ********************************************************************************/
+    using Source = uint32_t (*)(double* input, double* output,
+                                const uint32_t first, const uint32_t count);
+
+    /********************************************************************************
+     * @brief Creates new stream trainer.
+     *
+     * @param bias         Initial bias value (default = 0).
+     * @param weight       Initial weight value (default = 0).
+     * @param learningRate Learning rate used for gradient descent (default = 0.01).
+     ********************************************************************************/
+    StreamTrainer(const double bias = 0.0,
+                  const double weight = 0.0,
+                  const double learningRate = 0.01);
+
+    /********************************************************************************
+     * @brief Fits the model with the closed-form least squares solution in a
+     *        single pass over the source.
+     *
+     * @param source The source to read training data from.
+     *
+     * @return True if the model was fitted, false if the source is invalid,
+     *         returns more samples than requested or the input values don't 
+     *         vary.
+     ********************************************************************************/
+    bool fit(Source source);
+
+    /********************************************************************************
+     * @brief Trains the model via gradient descent, where each epoch is a full
+     *        pass over the source.
+     *
+     * @param source The source to read training data from.
+     * @param epochs The number of epochs to train the model.
+     *
+     * @return True if training was successful, else false. Training stops 
+     *         with false if the source returns more samples than requested.
+     ********************************************************************************/
+    bool train(Source source, const uint16_t epochs);
+
+    /********************************************************************************
+     * @brief Get the current bias value.
+     *
+     * @return Current bias value.
+     ********************************************************************************/
+    double getBias() const;
+
+    /********************************************************************************
+     * @brief Get the current weight value.
+     *
+     * @return Current weight value.
+     ********************************************************************************/
+    double getWeight() const;
+
+    /********************************************************************************
+     * @brief Get the number of samples read from the source during the last pass.
+     *
+     * @return Number of training sets.
+     ********************************************************************************/
+    uint32_t getTrainingSetCount() const;
+
+    /********************************************************************************
+     * @brief Predict the output for a given input.
+     *
+     * @param input Input value for prediction.
+     *
+     * @return Predicted output value.
+     ********************************************************************************/
+    double predict(const double input) const;
+
+private:
+    void step(const uint32_t count);
+
+    container::Array<double, ChunkSize> myInput{};
+    container::Array<double, ChunkSize> myOutput{};
+    double myBias;
+    double myWeight;
+    double myLearningRate;
+    uint32_t myTrainingSetCount{};
+};
+
+} // namespace ml
+
+#include "stream_trainer_impl.h"
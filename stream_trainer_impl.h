@@ -0,0 +1,97 @@
+/********************************************************************************
+ * @brief Implementation details of the ml::StreamTrainer class.
+ *
+ * @note Don't include this header, use <stream_trainer.h> instead!
+ ********************************************************************************/
+#pragma once
+
+namespace ml
+{
+
+// -----------------------------------------------------------------------------
+template <size_t ChunkSize>
+StreamTrainer<ChunkSize>::StreamTrainer(const double bias,
+                                        const double weight,
+                                        const double learningRate)
+    : myBias{bias}
+    , myWeight{weight}
+    , myLearningRate{learningRate}
+{
+    static_assert(ChunkSize > 0U, "Chunk size must exceed 0!");
+}
+
+// -----------------------------------------------------------------------------
+template <size_t ChunkSize>
+bool StreamTrainer<ChunkSize>::fit(Source source)
+{
+    if (source == nullptr) { return false; }
+    Statistics statistics{};
+    uint32_t count{};
+
+    while ((count = source(myInput.data(), myOutput.data(),
+                           statistics.count(), ChunkSize)) > 0U)
+    {
+        if (count > ChunkSize) { return false; }
+        statistics.add(myInput.data(), myOutput.data(), count);
+    }
+    myTrainingSetCount = statistics.count();
+    return statistics.solve(myBias, myWeight);
+}
+
+// -----------------------------------------------------------------------------
+template <size_t ChunkSize>
+bool StreamTrainer<ChunkSize>::train(Source source, const uint16_t epochs)
+{
+    if (source == nullptr || epochs == 0U || myLearningRate <= 0) { return false; }
+
+    for (uint16_t epoch{}; epoch < epochs; ++epoch)
+    {
+        uint32_t first{};
+        uint32_t count{};
+
+        while ((count = source(myInput.data(), myOutput.data(), first, ChunkSize)) > 0U)
+        {
+            if (count > ChunkSize) { return false; }
+            step(count);
+            first += count;
+        }
+        myTrainingSetCount = first;
+    }
+    return myTrainingSetCount > 0U;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t ChunkSize>
+double StreamTrainer<ChunkSize>::getBias() const { return myBias; }
+
+// -----------------------------------------------------------------------------
+template <size_t ChunkSize>
+double StreamTrainer<ChunkSize>::getWeight() const { return myWeight; }
+
+// -----------------------------------------------------------------------------
+template <size_t ChunkSize>
+uint32_t StreamTrainer<ChunkSize>::getTrainingSetCount() const
+{
+    return myTrainingSetCount;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t ChunkSize>
+double StreamTrainer<ChunkSize>::predict(const double input) const
+{
+    return myBias + myWeight * input;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t ChunkSize>
+void StreamTrainer<ChunkSize>::step(const uint32_t count)
+{
+    for (uint32_t i{}; i < count; ++i)
+    {
+        const double error{myOutput[i] - predict(myInput[i])};
+        myBias += error * myLearningRate;
+        myWeight += error * myLearningRate * myInput[i];
+    }
+}
+
+} // namespace ml
@@ -248,4 +248,70 @@ struct is_reference<T&>
     static const bool value{true};
 };
 
+/******************************************************************************** 
+ * @brief Indicates if specified type T is trivially copyable, i.e. if objects
+ *        of the type can be copied byte by byte, for instance via memcpy.
+ * 
+ * @tparam T The type to check.
+ *
+ * @param value Constant set to true for trivially copyable types, false for 
+ *              everything else.
+ ********************************************************************************/
+template <typename T>
+struct is_trivially_copyable
+{
+    static const bool value{__is_trivially_copyable(T)};
+};
+
+/******************************************************************************** 
+ * @brief Indicates if specified type T is trivially destructible, i.e. if 
+ *        objects of the type can be discarded without calling a destructor.
+ * 
+ * @tparam T The type to check.
+ *
+ * @param value Constant set to true for trivially destructible types, false 
+ *              for everything else.
+ ********************************************************************************/
+template <typename T>
+struct is_trivially_destructible
+{
+#if defined(__has_builtin)
+#if __has_builtin(__is_trivially_destructible)
+    static const bool value{__is_trivially_destructible(T)};
+#else
+    // GCC only provides the older trait, which is deprecated in Clang.
+    static const bool value{__has_trivial_destructor(T)};
+#endif
+#else
+    static const bool value{__has_trivial_destructor(T)};
+#endif
+};
+
+/******************************************************************************** 
+ * @brief Selects type TrueType if specified condition is true, else FalseType.
+ * 
+ * @tparam Condition The condition to evaluate.
+ * @tparam TrueType  The type selected if the condition is true.
+ * @tparam FalseType The type selected if the condition is false.
+ *
+ * @param type The selected type.
+ ********************************************************************************/
+template <bool Condition, typename TrueType, typename FalseType>
+struct conditional
+{
+    using type = TrueType;
+};
+
+/********************************************************************************
+ * @brief Selects type FalseType when the condition is false.
+ * 
+ * @param TrueType  The type not selected.
+ * @param FalseType The selected type.
+ ********************************************************************************/
+template <typename TrueType, typename FalseType>
+struct conditional<false, TrueType, FalseType>
+{
+    using type = FalseType;
+};
+
 } // namespace type_traits
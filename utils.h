@@ -13,6 +13,27 @@
 #include <util/delay.h>
 #include "type_traits.h"
 
+#if __has_include(<new>)
+#include <new>
+#else
+/********************************************************************************
+ * @brief Placement new, i.e. constructs an object at specified address. The
+ *        operator is normally declared in <new>, which avr-libc doesn't 
+ *        provide.
+ *
+ * @param address The address at which to construct the object.
+ *
+ * @return The address of the object.
+ ********************************************************************************/
+inline void* operator new(size_t, void* address) noexcept { return address; }
+
+/********************************************************************************
+ * @brief Placement delete, called if a constructor invoked via placement new
+ *        throws. No memory is released.
+ ********************************************************************************/
+inline void operator delete(void*, void*) noexcept {}
+#endif
+
 namespace utils 
 {
 
@@ -52,6 +73,24 @@ struct RemoveReference
     typedef T type;
 };
 
+/********************************************************************************
+ * @brief Specialization of RemoveReference for lvalue references.
+ ********************************************************************************/
+template <typename T>
+struct RemoveReference<T&>
+{
+    typedef T type;
+};
+
+/********************************************************************************
+ * @brief Specialization of RemoveReference for rvalue references.
+ ********************************************************************************/
+template <typename T>
+struct RemoveReference<T&&>
+{
+    typedef T type;
+};
+
 /********************************************************************************
  * @brief Maintains the value category of specified value.
  *
@@ -82,6 +121,12 @@ inline void globalInterruptEnable(void);
  ********************************************************************************/
 inline void globalInterruptDisable(void);
 
+/********************************************************************************
+ * @brief Prevents the compiler from moving memory accesses across this point,
+ *        e.g. to write data before publishing it to an interrupt routine.
+ ********************************************************************************/
+inline void memoryBarrier(void);
+
 /********************************************************************************
  * @brief Sets specified bit of selected register.
  *
@@ -220,15 +265,43 @@ template <typename T>
 inline void deleteMemory(T* &block);
 
 /********************************************************************************
- * @brief Moves memory from specified source to a copy. The copy will gain
- *        ownership of the memory and the source will be emptied.
+ * @brief Casts specified value to an rvalue reference, so that its memory can
+ *        be moved (rather than copied) to another object, which will gain
+ *        ownership of the memory. The source is left in a valid, but 
+ *        unspecified (typically empty) state.
+ *
+ * @param source Reference to the source whose memory is to be moved.
+ *
+ * @return An rvalue reference to the source.
+ ********************************************************************************/
+template <typename T>
+constexpr typename RemoveReference<T>::type&& move(T&& source) noexcept;
+
+/********************************************************************************
+ * @brief Constructs an object at specified address via placement new. The
+ *        arguments are passed in parentheses, so they select a constructor
+ *        the same way as for a direct call, without initializer list 
+ *        constructors or narrowing checks getting in the way.
+ *
+ * @tparam T    The type of the object.
+ * @tparam Args The types of the constructor arguments.
  *
- * @param source Reference to the source whose memory is moved.
+ * @param address Pointer to uninitialized memory for the object.
+ * @param args    The constructor arguments.
+ *
+ * @return Pointer to the constructed object.
+ ********************************************************************************/
+template <typename T, typename... Args>
+inline T* construct(T* address, Args&&... args);
+
+/********************************************************************************
+ * @brief Destroys the object at specified address without releasing its
+ *        memory, i.e. calls its destructor.
  *
- * @return The copy of the source.
+ * @param address Pointer to the object to destroy.
  ********************************************************************************/
 template <typename T>
-inline T move(T&& source);
+inline void destroy(T* address);
 
 } // namespace
 } // namespace utils
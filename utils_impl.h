@@ -30,6 +30,9 @@ inline void globalInterruptEnable(void) { asm("SEI"); }
 // -----------------------------------------------------------------------------
 inline void globalInterruptDisable(void) { asm("CLI"); }
 
+// -----------------------------------------------------------------------------
+inline void memoryBarrier(void) { asm volatile("" ::: "memory"); }
+
 // -----------------------------------------------------------------------------
 template <typename T>
 constexpr void set(volatile T& reg, const uint8_t bit)  
@@ -153,12 +156,21 @@ inline void deleteMemory(T* &block)
 
 // -----------------------------------------------------------------------------
 template <typename T>
-inline T move(T&& source) 
+constexpr typename RemoveReference<T>::type&& move(T&& source) noexcept
 {
-    T copy{source};
-    source = {};
-    return copy;
+    return static_cast<typename RemoveReference<T>::type&&>(source);
 }
 
+// -----------------------------------------------------------------------------
+template <typename T, typename... Args>
+inline T* construct(T* address, Args&&... args)
+{
+    return new (address) T(forward<Args>(args)...);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+inline void destroy(T* address) { address->~T(); }
+
 } // namespace
 } // namespace utils
\ No newline at end of file
@@ -54,10 +54,10 @@ public:
      *
      * @param source Reference to vector whose content is moved to assigned vector.
      ********************************************************************************/
-    Vector(Vector&& source);
+    Vector(Vector&& source) noexcept;
 
     /********************************************************************************
-     * @brief Empties vector before deletion.
+     * @brief Destroys the elements and empties vector before deletion.
      ********************************************************************************/
     ~Vector();
 
@@ -98,6 +98,14 @@ public:
      ********************************************************************************/
     void operator=(const Vector<T>& source);
 
+    /********************************************************************************
+     * @brief Moves memory from referenced source to assigned vector. Previous 
+     *        values are cleared and the source vector is emptied.
+     *
+     * @param source Reference to vector whose content is moved to assigned vector.
+     ********************************************************************************/
+    void operator=(Vector<T>&& source) noexcept;
+
     /********************************************************************************
      * @brief Pushes referenced values to the back of the vector.
      *
@@ -123,12 +131,20 @@ public:
     const T* data() const;
 
     /********************************************************************************
-     * @brief Returns the size of the vector in the number of elements it can hold.
+     * @brief Returns the size of the vector in the number of elements it holds.
      *
      * @return The size of the vector as an unsigned integer.
      ********************************************************************************/
     size_t size() const;
 
+    /********************************************************************************
+     * @brief Returns the capacity of the vector, i.e. the number of elements it 
+     *        can hold before it must be reallocated.
+     *
+     * @return The capacity of the vector as an unsigned integer.
+     ********************************************************************************/
+    size_t capacity() const;
+
     /********************************************************************************
      * @brief Indicates if the vector is empty.
      *
@@ -212,7 +228,8 @@ public:
     void clear();
 
     /********************************************************************************
-     * @brief Resizes the vector to specified new size.
+     * @brief Resizes the vector to specified new size. The vector is only 
+     *        reallocated if the new size exceeds the capacity.
      *
      * @param newSize The new size of the vector.
      * 
@@ -221,7 +238,26 @@ public:
     bool resize(const size_t newSize);
 
     /********************************************************************************
-     * @brief Pushes new value to the back of the vector.
+     * @brief Reserves memory for at least specified number of elements, so that
+     *        the vector can grow to that size without being reallocated.
+     *
+     * @param newCapacity The requested capacity of the vector.
+     * 
+     * @return True if the memory was reserved, else false.
+     ********************************************************************************/
+    bool reserve(const size_t newCapacity);
+
+    /********************************************************************************
+     * @brief Releases unused capacity, so that the vector only occupies the 
+     *        memory needed for its elements.
+     * 
+     * @return True if the unused capacity was released, else false.
+     ********************************************************************************/
+    bool shrinkToFit();
+
+    /********************************************************************************
+     * @brief Pushes new value to the back of the vector. The capacity grows
+     *        geometrically, so the vector is only reallocated occasionally.
      *
      * @param value Reference to the new value to push to the vector.
      * 
@@ -229,8 +265,30 @@ public:
      ********************************************************************************/
     bool pushBack(const T& value);
 
+    /********************************************************************************
+     * @brief Pushes new value to the back of the vector. The value is moved
+     *        instead of copied.
+     *
+     * @param value Reference to the new value to move to the vector.
+     * 
+     * @return True if the value was pushed to the back of the vector, else false.
+     ********************************************************************************/
+    bool pushBack(T&& value);
+
+    /********************************************************************************
+     * @brief Constructs new value in place at the back of the vector.
+     *
+     * @tparam Args The types of the constructor arguments.
+     * 
+     * @param args The arguments passed to the constructor of the new value.
+     * 
+     * @return True if the value was constructed, else false.
+     ********************************************************************************/
+    template <typename... Args>
+    bool emplaceBack(Args&&... args);
+
     /******************************************************************************** 
-     * @brief Pops value at the back of the vector.
+     * @brief Pops value at the back of the vector. The capacity is retained.
      *
      * @return True if the last value of the vector was popped, else false.
      ********************************************************************************/
@@ -244,10 +302,15 @@ protected:
     bool addValues(const Vector<T>& source);
     template <size_t NumValues>
     bool addValues(const T (&values)[NumValues]);
-    T* realloc(const size_t newSize);
+    void assign(const T* values, const size_t numValues, const size_t offset);
+    void append(const T* values, const size_t numValues);
+    bool grow(const size_t minCapacity);
+    void destroy(const size_t first, const size_t last);
+    bool reallocate(const size_t newCapacity);
 
     T* myData{nullptr}; 
     size_t mySize{};  
+    size_t myCapacity{};
 };
 
 /********************************************************************************
@@ -5,10 +5,22 @@
  ********************************************************************************/
 #pragma once 
 
+#include <string.h>
+
+#include "type_traits.h"
 #include "utils.h"
 
 namespace container
 {
+namespace detail
+{
+
+/********************************************************************************
+ * @brief The smallest capacity allocated when a vector grows.
+ ********************************************************************************/
+constexpr size_t MinCapacity{4U};
+
+} // namespace detail
 
 // -----------------------------------------------------------------------------
 template <typename T>
@@ -33,12 +45,14 @@ Vector<T>::Vector(const Vector<T>& source) { copy(source); }
 
 // -----------------------------------------------------------------------------
 template <typename T>
-Vector<T>::Vector(Vector&& source) 
+Vector<T>::Vector(Vector&& source) noexcept
 {
     myData = source.myData;
     mySize = source.mySize;
+    myCapacity = source.myCapacity;
     source.myData = nullptr;
     source.mySize = 0;
+    source.myCapacity = 0;
 }
 
 // -----------------------------------------------------------------------------
@@ -66,10 +80,25 @@ void Vector<T>::operator=(const Values&&... values)
 template <typename T>
 void Vector<T>::operator=(const Vector<T>& source) 
 {
+    if (this == &source) { return; }
     clear();
     copy(source);
 }
 
+// -----------------------------------------------------------------------------
+template <typename T>
+void Vector<T>::operator=(Vector<T>&& source) noexcept
+{
+    if (this == &source) { return; }
+    clear();
+    myData = source.myData;
+    mySize = source.mySize;
+    myCapacity = source.myCapacity;
+    source.myData = nullptr;
+    source.mySize = 0;
+    source.myCapacity = 0;
+}
+
 // -----------------------------------------------------------------------------
 template <typename T>
 template <size_t NumValues>
@@ -87,6 +116,10 @@ const T* Vector<T>::data() const { return myData; }
 template <typename T>
 size_t Vector<T>::size() const { return mySize; }
 
+// -----------------------------------------------------------------------------
+template <typename T>
+size_t Vector<T>::capacity() const { return myCapacity; }
+
 // -----------------------------------------------------------------------------
 template <typename T>
 bool Vector<T>::empty() const { return mySize == 0; }
@@ -156,52 +189,95 @@ const T* Vector<T>::last() const { return mySize > 0 ? end() - 1 : nullptr; }
 template <typename T>
 void Vector<T>::clear() 
 {
+    destroy(0, mySize);
     utils::deleteMemory<T>(myData);
     myData = nullptr;
     mySize = 0;
+    myCapacity = 0;
 }
 
 // -----------------------------------------------------------------------------
 template <typename T>
 bool Vector<T>::resize(const size_t newSize) 
 {
-    auto copy{utils::reallocMemory<T>(myData, newSize)};
-    if (copy == nullptr) { return false; }
-    myData = copy;
+    if (!reserve(newSize)) { return false; }
+    for (size_t i{mySize}; i < newSize; ++i) { utils::construct(myData + i); }
+    destroy(newSize, mySize);
     mySize = newSize;
     return true;
 }
 
 // -----------------------------------------------------------------------------
 template <typename T>
-bool Vector<T>::pushBack(const T& value) 
+bool Vector<T>::reserve(const size_t newCapacity) 
 {
-    if (!resize(mySize + 1)) { return false; }
-    myData[mySize - 1] = value;
-    return true;
+    return newCapacity <= myCapacity || reallocate(newCapacity);
 }
 
 // -----------------------------------------------------------------------------
 template <typename T>
-bool Vector<T>::popBack() 
+bool Vector<T>::shrinkToFit() 
 {
-    if (mySize <= 1) 
+    if (mySize == myCapacity) { return true; }
+    if (mySize == 0) 
     {
         clear();
         return true;
-    } 
+    }
+    return reallocate(mySize);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool Vector<T>::pushBack(const T& value) 
+{
+    return emplaceBack(value);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool Vector<T>::pushBack(T&& value) 
+{
+    return emplaceBack(utils::move(value));
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+template <typename... Args>
+bool Vector<T>::emplaceBack(Args&&... args) 
+{
+    if (mySize < myCapacity) 
+    {
+        utils::construct(myData + mySize, utils::forward<Args>(args)...);
+    }
     else 
     {
-        return resize(mySize - 1);
+        // The arguments may refer to elements of the vector, hence the value is
+        // constructed before the elements are relocated.
+        T value(utils::forward<Args>(args)...);
+        if (!grow(mySize + 1)) { return false; }
+        utils::construct(myData + mySize, utils::move(value));
     }
+    mySize++;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool Vector<T>::popBack() 
+{
+    if (mySize > 0) { utils::destroy(myData + --mySize); }
+    return true;
 }
 
 // -----------------------------------------------------------------------------
 template <typename T>
 bool Vector<T>::copy(const Vector<T>& source) 
 {
-    if (!resize(source.mySize)) { return false; }
-    assign(source);
+    destroy(0, mySize);
+    mySize = 0;
+    if (!reserve(source.mySize)) { return false; }
+    append(source.myData, source.mySize);
     return true;
 }
 
@@ -209,10 +285,7 @@ bool Vector<T>::copy(const Vector<T>& source)
 template <typename T>
 void Vector<T>::assign(const Vector<T>& source, const size_t offset) 
 {
-    for (size_t i{}; offset + i < mySize && i < source.mySize; ++i) 
-    {
-        myData[offset + i] = source.myData[i];
-    }
+    assign(source.myData, source.mySize, offset);
 }
 
 // -----------------------------------------------------------------------------
@@ -220,9 +293,26 @@ template <typename T>
 template <size_t NumValues>
 void Vector<T>::assign(const T (&values)[NumValues], const size_t offset) 
 {
-    for (size_t i{}; i < NumValues && offset + i < mySize; ++i) 
+    assign(values, NumValues, offset);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void Vector<T>::assign(const T* values, const size_t numValues, const size_t offset) 
+{
+    if (offset >= mySize) { return; }
+    const auto count{numValues < mySize - offset ? numValues : mySize - offset};
+
+    if constexpr (type_traits::is_trivially_copyable<T>::value)
+    {
+        memmove(myData + offset, values, count * sizeof(T));
+    }
+    else
     {
-        myData[offset + i] = values[i];
+        for (size_t i{}; i < count; ++i) 
+        {
+            myData[offset + i] = values[i];
+        }
     }
 }
 
@@ -230,9 +320,10 @@ void Vector<T>::assign(const T (&values)[NumValues], const size_t offset)
 template <typename T>
 bool Vector<T>::addValues(const Vector<T>& source) 
 {
-    const auto offset{mySize};
-    if (!resize(mySize + source.mySize)) { return false; }
-    assign(source, offset);
+    // The source is read after growing, since it may be this vector.
+    const auto count{source.mySize};
+    if (!grow(mySize + count)) { return false; }
+    append(source.myData, count);
     return true;
 }
 
@@ -241,12 +332,86 @@ template <typename T>
 template <size_t NumValues>
 bool Vector<T>::addValues(const T (&values)[NumValues]) 
 {
-    const auto offset{mySize};
-    if (!resize(mySize + NumValues)) { return false; }
-    assign(values, offset);
+    if (!grow(mySize + NumValues)) { return false; }
+    append(values, NumValues);
     return true;
 }
 
+// -----------------------------------------------------------------------------
+template <typename T>
+void Vector<T>::append(const T* values, const size_t numValues) 
+{
+    if constexpr (type_traits::is_trivially_copyable<T>::value)
+    {
+        memcpy(myData + mySize, values, numValues * sizeof(T));
+        mySize += numValues;
+    }
+    else
+    {
+        for (size_t i{}; i < numValues; ++i) 
+        {
+            utils::construct(myData + mySize, values[i]);
+            mySize++;
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool Vector<T>::grow(const size_t minCapacity) 
+{
+    // Grows by a factor 1.5 rather than 2, so that freed blocks can be reused
+    // by later growth, which limits fragmentation of the small AVR heap.
+    if (minCapacity <= myCapacity) { return true; }
+    const auto geometric{myCapacity + myCapacity / 2};
+    const auto newCapacity{geometric > minCapacity ? geometric : minCapacity};
+    return reallocate(newCapacity > detail::MinCapacity ? newCapacity : detail::MinCapacity);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool Vector<T>::reallocate(const size_t newCapacity) 
+{
+    if constexpr (type_traits::is_trivially_copyable<T>::value)
+    {
+        // Trivially copyable elements can be relocated by realloc, which may 
+        // even grow the block in place.
+        auto block{utils::reallocMemory<T>(myData, newCapacity)};
+        if (block == nullptr) { return false; }
+        myData = block;
+        myCapacity = newCapacity;
+        if (mySize > newCapacity) { mySize = newCapacity; }
+        return true;
+    }
+
+    // The elements are moved into the new block, so elements owning memory
+    // of their own (such as nested vectors) hand it over instead of copying.
+    auto block{utils::newMemory<T>(newCapacity)};
+    if (block == nullptr) { return false; }
+    const auto count{mySize < newCapacity ? mySize : newCapacity};
+
+    for (size_t i{}; i < count; ++i) 
+    {
+        utils::construct(block + i, utils::move(myData[i]));
+    }
+    destroy(0, mySize);
+    utils::deleteMemory<T>(myData);
+    myData = block;
+    mySize = count;
+    myCapacity = newCapacity;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void Vector<T>::destroy(const size_t first, const size_t last) 
+{
+    if constexpr (!type_traits::is_trivially_destructible<T>::value)
+    {
+        for (size_t i{first}; i < last; ++i) { utils::destroy(myData + i); }
+    }
+}
+
 // -----------------------------------------------------------------------------
 template <typename T>
 Vector<T>::Iterator::Iterator() = default;